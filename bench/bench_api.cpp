@@ -0,0 +1,421 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks for the hot entry points of every C API family.
+//
+// Usage: amplitude_c_bench [--json <path>] [--filter <text>]
+//                          [--min-time <seconds>] [--repetitions <count>]
+//                          [--engine-config <path>] [--assets <directory>]
+//
+// Entity and listener benchmarks need a running engine, and are skipped unless
+// an engine configuration file is given. Everything else only needs am_boot().
+
+#include <cstring>
+#include <vector>
+
+#include "bench_engine.h"
+#include "bench_harness.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+static constexpr am_uint16 kChannels = 2;
+static constexpr am_uint64 kFramesCount = 1ull << 32;
+static constexpr am_size kFileSize = 1 << 16;
+
+// Stub decoder, reports frames without producing them so only the bindings
+// are measured.
+
+static am_bool stub_open(am_voidptr, am_file_handle) { return AM_TRUE; }
+
+static am_bool stub_close(am_voidptr) { return AM_TRUE; }
+
+static void stub_get_format(am_voidptr, am_sound_format *format) {
+  am_sound_format_set_all(format, 48000, kChannels, 32, kFramesCount,
+                          sizeof(float) * kChannels,
+                          am_audio_sample_format_float32);
+}
+
+static am_uint64 stub_load(am_voidptr, am_voidptr) { return kFramesCount; }
+
+static am_uint64 stub_stream(am_voidptr, am_voidptr, am_uint64, am_uint64,
+                             am_uint64 length) {
+  return length;
+}
+
+static am_bool stub_seek(am_voidptr, am_uint64) { return AM_TRUE; }
+
+// Custom file over a static buffer, exercising the CFile vtable dispatch.
+
+struct StubFile {
+  am_uint8 data[kFileSize];
+  am_size position;
+};
+
+static StubFile g_file;
+
+static const am_oschar *stub_file_get_path(am_voidptr) {
+  static const am_oschar path[] = {'b', 'e', 'n', 'c', 'h', '\0'};
+  return path;
+}
+
+static am_bool stub_file_eof(am_voidptr user_data) {
+  const auto *file = static_cast<StubFile *>(user_data);
+  return file->position >= kFileSize ? AM_TRUE : AM_FALSE;
+}
+
+static am_size stub_file_read(am_voidptr user_data, am_uint8 *buffer,
+                              am_size bytes) {
+  auto *file = static_cast<StubFile *>(user_data);
+  bytes = std::min<am_size>(bytes, kFileSize - file->position);
+  std::memcpy(buffer, file->data + file->position, bytes);
+  file->position += bytes;
+  return bytes;
+}
+
+static am_size stub_file_write(am_voidptr, const am_uint8 *, am_size) {
+  return 0;
+}
+
+static am_size stub_file_length(am_voidptr) { return kFileSize; }
+
+static void stub_file_seek(am_voidptr user_data, am_uint64 offset,
+                           am_file_seek_origin origin) {
+  auto *file = static_cast<StubFile *>(user_data);
+  const am_uint64 base = origin == am_file_seek_origin_start ? 0
+                         : origin == am_file_seek_origin_end ? kFileSize
+                                                             : file->position;
+  file->position = static_cast<am_size>(std::min<am_uint64>(base + offset, kFileSize));
+}
+
+static am_size stub_file_position(am_voidptr user_data) {
+  return static_cast<StubFile *>(user_data)->position;
+}
+
+static am_voidptr stub_file_get_ptr(am_voidptr user_data) {
+  return static_cast<StubFile *>(user_data)->data;
+}
+
+static am_bool stub_file_is_valid(am_voidptr) { return AM_TRUE; }
+
+static void stub_file_close(am_voidptr) {}
+
+static void empty_task(am_thread_pool_task_awaitable_handle, am_voidptr) {}
+
+static void bench_codec(bench::Harness &harness, am_file_handle file) {
+  am_codec_decoder_handle decoder = am_codec_decoder_create("bench_stub");
+  if (!decoder || !am_codec_decoder_open(decoder, file)) {
+    harness.Skip("codec/stream", "unable to open the stub decoder");
+    return;
+  }
+
+  harness.Run("handle/decoder_get_format", [&](am_uint64 iterations) {
+    am_sound_format format;
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      am_codec_decoder_get_format(decoder, &format);
+      bench::do_not_optimize(format);
+    }
+  });
+
+  harness.Run("codec/seek", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      bench::do_not_optimize(am_codec_decoder_seek(decoder, i & 0xFFFF));
+  });
+
+  std::vector<float> buffer(4096 * kChannels);
+  for (const am_uint64 block : {1ull, 64ull, 1024ull, 4096ull}) {
+    const std::string name = "codec/stream/" + std::to_string(block);
+    harness.Run(
+        name.c_str(),
+        [&](am_uint64 iterations) {
+          am_uint64 offset = 0;
+          for (am_uint64 i = 0; i < iterations; ++i) {
+            offset += am_codec_decoder_stream(decoder, buffer.data(), 0,
+                                              offset, block);
+          }
+          bench::do_not_optimize(offset);
+        },
+        block);
+  }
+
+  // Batched resolution of many handles under a single registry lock
+  constexpr am_size kBatch = 64;
+  std::vector<am_codec_decoder_handle> decoders(kBatch, decoder);
+  std::vector<am_voidptr> outs(kBatch, buffer.data());
+  std::vector<am_uint64> seeks(kBatch, 0);
+  std::vector<am_uint64> lengths(kBatch, 1);
+  std::vector<am_uint64> results(kBatch, 0);
+
+  harness.Run(
+      "codec/stream_many/64",
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i) {
+          am_codec_decoder_stream_many(decoders.data(), outs.data(), nullptr,
+                                       seeks.data(), lengths.data(),
+                                       results.data(), kBatch, nullptr);
+        }
+        bench::do_not_optimize(results[0]);
+      },
+      kBatch);
+
+  am_codec_decoder_close(decoder);
+  am_codec_decoder_destroy(decoder);
+}
+
+static void bench_file(bench::Harness &harness) {
+  am_file_vtable v_table = {};
+  v_table.get_path = stub_file_get_path;
+  v_table.eof = stub_file_eof;
+  v_table.read = stub_file_read;
+  v_table.write = stub_file_write;
+  v_table.length = stub_file_length;
+  v_table.seek = stub_file_seek;
+  v_table.position = stub_file_position;
+  v_table.get_ptr = stub_file_get_ptr;
+  v_table.is_valid = stub_file_is_valid;
+  v_table.close = stub_file_close;
+
+  am_file_config config = am_file_config_init_custom();
+  config.user_data = &g_file;
+  config.v_table = &v_table;
+
+  am_file_handle file = am_file_create(&config);
+
+  harness.Run("file/read32", [&](am_uint64 iterations) {
+    am_uint32 sum = 0;
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      if (g_file.position + 4 > kFileSize)
+        am_file_seek(file, 0, am_file_seek_origin_start);
+      sum += am_file_read32(file);
+    }
+    bench::do_not_optimize(sum);
+  });
+
+  std::vector<am_uint8> buffer(4096);
+  harness.Run(
+      "file/read/4096",
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i) {
+          am_file_seek(file, (i * buffer.size()) % kFileSize,
+                       am_file_seek_origin_start);
+          bench::do_not_optimize(
+              am_file_read(file, buffer.data(), buffer.size()));
+        }
+      },
+      buffer.size());
+
+  harness.Run("string/file_get_path", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      const am_oschar *path = am_file_get_path(file);
+      bench::do_not_optimize(path);
+      am_memory_manager_free(am_memory_pool_kind_default,
+                             const_cast<am_oschar *>(path));
+    }
+  });
+
+  am_file_destroy(file);
+}
+
+static void bench_thread_pool(bench::Harness &harness) {
+  am_thread_pool_handle pool = am_thread_pool_create(2);
+
+  harness.Run("thread/submit_await", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      am_thread_pool_task_awaitable_handle task =
+          am_thread_pool_task_awaitable_create(empty_task, nullptr);
+      am_thread_pool_add_task_awaitable(pool, task);
+      am_thread_pool_task_awaitable_await(task);
+      am_thread_pool_task_awaitable_destroy(task);
+    }
+  });
+
+  harness.Run("thread/create_destroy_task", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      am_thread_pool_task_awaitable_handle task =
+          am_thread_pool_task_awaitable_create(empty_task, nullptr);
+      am_thread_pool_task_awaitable_destroy(task);
+    }
+  });
+
+  am_thread_pool_destroy(pool);
+}
+
+static void bench_strings(bench::Harness &harness) {
+  am_codec_handle codec = am_codec_find("bench_stub");
+
+  harness.Run("string/codec_get_name", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i) {
+      const char *name = am_codec_get_name(codec);
+      bench::do_not_optimize(name);
+      am_memory_free_str(name);
+    }
+  });
+
+  harness.Run("handle/codec_find", [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      bench::do_not_optimize(am_codec_find("bench_stub"));
+  });
+}
+
+static void bench_entities(bench::Harness &harness) {
+  const char *config = harness.GetOption("--engine-config");
+  const char *names[] = {
+      "entity/set_location",   "entity/set_orientation",
+      "entity/get_location",   "listener/set_location",
+      "listener/set_orientation", "listener/get_inverse_matrix",
+      "listener/set_state_many/4",
+      "listener/transform_points/1024",
+      "listener/get_spherical_positions/1024",
+  };
+
+  DiskFileSystem filesystem;
+  if (!config || !bench::start_engine(filesystem, config,
+                               harness.GetOption("--assets"))) {
+    for (const char *name : names)
+      harness.Skip(name, config ? "engine failed to initialize"
+                                : "no --engine-config given");
+    return;
+  }
+
+  auto entity = reinterpret_cast<am_entity_handle>(
+      amEngine->AddEntity(1).GetState());
+  auto listener = reinterpret_cast<am_listener_handle>(
+      amEngine->AddListener(1).GetState());
+
+  const am_quaternion orientation = {1.0f, 0.0f, 0.0f, 0.0f};
+
+  harness.Run(names[0], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      am_entity_set_location(entity, {static_cast<float>(i & 255), 0.0f, 1.0f});
+  });
+
+  harness.Run(names[1], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      am_entity_set_orientation(entity, orientation);
+  });
+
+  harness.Run(names[2], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      bench::do_not_optimize(am_entity_get_location(entity));
+  });
+
+  harness.Run(names[3], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      am_listener_set_location(listener,
+                               {static_cast<float>(i & 255), 0.0f, 1.0f});
+  });
+
+  harness.Run(names[4], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      am_listener_set_orientation(listener, orientation);
+  });
+
+  harness.Run(names[5], [&](am_uint64 iterations) {
+    for (am_uint64 i = 0; i < iterations; ++i)
+      bench::do_not_optimize(am_listener_get_inverse_matrix(listener));
+  });
+
+  // Split-screen update: 4 listeners set and read back in one call
+  am_listener_handle listeners[4] = {listener};
+  for (am_uint64 i = 1; i < 4; ++i)
+    listeners[i] = reinterpret_cast<am_listener_handle>(
+        amEngine->AddListener(i + 1).GetState());
+
+  am_vec3 locations[4] = {};
+  am_quaternion orientations[4] = {orientation, orientation, orientation,
+                                   orientation};
+  am_mat4 matrices[4];
+
+  harness.Run(
+      names[6],
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i) {
+          locations[i & 3].x = static_cast<float>(i & 255);
+          am_listener_set_state_many(listeners, locations, orientations,
+                                     nullptr, nullptr, matrices, 4);
+          bench::do_not_optimize(matrices[0]);
+        }
+      },
+      4);
+
+  // Culling pass over a crowd of entities
+  std::vector<am_vec3> points(1024);
+  std::vector<am_vec3> transformed(points.size());
+  std::vector<am_float32> distances(points.size());
+  std::vector<am_float32> azimuths(points.size());
+  std::vector<am_float32> elevations(points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    points[i] = {static_cast<float>(i % 32), static_cast<float>(i / 32), 1.0f};
+
+  harness.Run(
+      names[7],
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i) {
+          am_listener_transform_points(listener, points.data(),
+                                       transformed.data(), points.size());
+          bench::do_not_optimize(transformed[0]);
+        }
+      },
+      points.size());
+
+  harness.Run(
+      names[8],
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i) {
+          am_listener_get_spherical_positions(
+              listener, points.data(), distances.data(), azimuths.data(),
+              elevations.data(), points.size());
+          bench::do_not_optimize(distances[0]);
+        }
+      },
+      points.size());
+
+  amEngine->RemoveEntity(1);
+  for (am_uint64 i = 1; i <= 4; ++i)
+    amEngine->RemoveListener(i);
+  bench::stop_engine();
+}
+
+int main(int argc, char **argv) {
+  bench::initialize_memory();
+  am_boot();
+
+  bench::Harness harness(argc, argv);
+
+  am_codec_decoder_vtable decoder_v_table = am_codec_decoder_vtable_init();
+  decoder_v_table.open = stub_open;
+  decoder_v_table.close = stub_close;
+  decoder_v_table.get_format = stub_get_format;
+  decoder_v_table.load = stub_load;
+  decoder_v_table.stream = stub_stream;
+  decoder_v_table.seek = stub_seek;
+
+  am_codec_config codec = am_codec_config_init("bench_stub");
+  codec.decoder.v_table = &decoder_v_table;
+  am_codec_register(&codec);
+
+  am_file_config file_config = am_file_config_init_memory();
+  am_file_handle file = am_file_create(&file_config);
+
+  bench_codec(harness, file);
+  bench_file(harness);
+  bench_thread_pool(harness);
+  bench_strings(harness);
+  bench_entities(harness);
+
+  am_file_destroy(file);
+  am_codec_unregister("bench_stub");
+  am_shutdown();
+
+  return harness.Finish();
+}
@@ -0,0 +1,253 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the decoding throughput of the C codec bindings.
+//
+// Three synthetic decoders with very different costs (memset, memcpy and a
+// sine generator) are registered through am_codec_register(), then streamed
+// through am_codec_decoder_stream() and through Codec::Decoder::Stream() on the
+// same decoder class. The difference between both paths, per call, is the cost
+// of the C wrapper layer: handle resolution and raw buffer dispatch.
+//
+// Before measuring, decoders are destroyed after their codec was unregistered,
+// with and without pooling, and the bench exits with an error if any of them
+// was not destroyed exactly once.
+//
+// Usage: amplitude_c_bench_codec [--json <path>] [--filter <text>]
+//                                [--min-time <seconds>] [--repetitions <count>]
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "bench_harness.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+static constexpr am_uint16 kChannels = 2;
+static constexpr am_uint32 kSampleRate = 48000;
+static constexpr am_uint64 kFramesCount = 1 << 16;
+static constexpr am_uint64 kBlockSizes[] = {64, 256, 1024, 4096};
+
+enum class SynthKind { Memset, Memcpy, Sine };
+
+struct Synth {
+  const char *name;
+  SynthKind kind;
+};
+
+static std::vector<float> g_source;
+
+static am_bool synth_open(am_voidptr, am_file_handle) { return AM_TRUE; }
+
+static am_bool synth_close(am_voidptr) { return AM_TRUE; }
+
+static void synth_get_format(am_voidptr, am_sound_format *format) {
+  am_sound_format_set_all(format, kSampleRate, kChannels, 32, kFramesCount,
+                          sizeof(float) * kChannels,
+                          am_audio_sample_format_float32);
+}
+
+static am_uint64 synth_stream(am_voidptr user_data, am_voidptr out,
+                              am_uint64 buffer_offset, am_uint64 seek_offset,
+                              am_uint64 length) {
+  const auto *synth = static_cast<const Synth *>(user_data);
+  auto *dst = static_cast<float *>(out) + buffer_offset * kChannels;
+
+  length = std::min<am_uint64>(length, kFramesCount - seek_offset);
+
+  switch (synth->kind) {
+  case SynthKind::Memset:
+    std::memset(dst, 0, length * kChannels * sizeof(float));
+    break;
+  case SynthKind::Memcpy:
+    std::memcpy(dst, g_source.data() + seek_offset * kChannels,
+                length * kChannels * sizeof(float));
+    break;
+  case SynthKind::Sine: {
+    const float step = 2.0f * 3.14159265f * 440.0f / kSampleRate;
+    for (am_uint64 i = 0; i < length; ++i) {
+      const float value = 0.5f * std::sin(step * (seek_offset + i));
+      for (am_uint16 c = 0; c < kChannels; ++c)
+        *dst++ = value;
+    }
+    break;
+  }
+  }
+
+  return length;
+}
+
+static am_uint64 synth_load(am_voidptr user_data, am_voidptr out) {
+  return synth_stream(user_data, out, 0, 0, kFramesCount);
+}
+
+static am_bool synth_seek(am_voidptr, am_uint64) { return AM_TRUE; }
+
+static int g_lifetime_alive = 0;
+
+static void lifetime_create(am_voidptr) { ++g_lifetime_alive; }
+
+static void lifetime_destroy(am_voidptr) { --g_lifetime_alive; }
+
+static am_bool lifetime_reset(am_voidptr) { return AM_TRUE; }
+
+static bool check_decoder_lifetime(bool pooled) {
+  am_codec_decoder_vtable v_table = am_codec_decoder_vtable_init();
+  v_table.create = lifetime_create;
+  v_table.destroy = lifetime_destroy;
+
+  am_codec_decoder_ext_vtable ext_v_table = am_codec_decoder_ext_vtable_init();
+  ext_v_table.reset = lifetime_reset;
+
+  am_codec_config codec = am_codec_config_init("bench_lifetime");
+  codec.decoder.v_table = &v_table;
+  if (pooled)
+    codec.decoder_ext_v_table = &ext_v_table;
+  am_codec_register(&codec);
+
+  // One decoder still held by the application, one idle in the pool
+  am_codec_decoder_handle held = am_codec_decoder_create("bench_lifetime");
+  am_codec_decoder_destroy(am_codec_decoder_create("bench_lifetime"));
+
+  am_codec_unregister("bench_lifetime");
+  am_codec_decoder_destroy(held);
+
+  if (g_lifetime_alive == 0)
+    return true;
+
+  std::printf("error: %d decoders not destroyed after unregistering (%s)\n",
+              g_lifetime_alive, pooled ? "pooled" : "not pooled");
+  g_lifetime_alive = 0;
+  return false;
+}
+
+static void bench_synth(bench::Harness &harness, const Synth &synth,
+                        am_file_handle file) {
+  const std::string prefix = std::string("codec/") + synth.name;
+
+  am_codec_decoder_handle handle = am_codec_decoder_create(synth.name);
+  if (!handle || !am_codec_decoder_open(handle, file)) {
+    harness.Skip(prefix.c_str(), "unable to open the decoder");
+    return;
+  }
+
+  std::vector<float> buffer(kFramesCount * kChannels);
+
+  harness.Run(
+      (prefix + "/load").c_str(),
+      [&](am_uint64 iterations) {
+        for (am_uint64 i = 0; i < iterations; ++i)
+          bench::do_not_optimize(am_codec_decoder_load(handle, buffer.data()));
+      },
+      kFramesCount);
+
+  // Same decoder class, driven through the SDK interface
+  std::shared_ptr<Codec::Decoder> decoder =
+      Codec::Find(synth.name)->CreateDecoder();
+  decoder->Open(std::shared_ptr<File>(static_cast<File *>(file.handle),
+                                      [](File *) {}));
+
+  for (const am_uint64 block : kBlockSizes) {
+    const std::string suffix = "/" + std::to_string(block);
+
+    const bench::Result *c_api = harness.Run(
+        (prefix + "/stream_c" + suffix).c_str(),
+        [&](am_uint64 iterations) {
+          am_uint64 offset = 0;
+          for (am_uint64 i = 0; i < iterations; ++i) {
+            am_codec_decoder_stream(handle, buffer.data(), 0, offset, block);
+            offset = (offset + block) % kFramesCount;
+          }
+        },
+        block);
+
+    AudioBuffer audio_buffer(block, kChannels);
+    const bench::Result *sdk = harness.Run(
+        (prefix + "/stream_sdk" + suffix).c_str(),
+        [&](am_uint64 iterations) {
+          am_uint64 offset = 0;
+          for (am_uint64 i = 0; i < iterations; ++i) {
+            decoder->Stream(&audio_buffer, 0, offset, block);
+            offset = (offset + block) % kFramesCount;
+          }
+        },
+        block);
+
+    if (c_api && sdk) {
+      harness.AddMetric((prefix + "/overhead" + suffix).c_str(),
+                        c_api->ns_per_op - sdk->ns_per_op, "ns/call");
+    }
+  }
+
+  decoder->Close();
+  am_codec_decoder_close(handle);
+  am_codec_decoder_destroy(handle);
+}
+
+int main(int argc, char **argv) {
+  bench::initialize_memory();
+  am_boot();
+
+  const bool lifetime_ok =
+      check_decoder_lifetime(false) && check_decoder_lifetime(true);
+  if (!lifetime_ok) {
+    am_shutdown();
+    return 1;
+  }
+
+  bench::Harness harness(argc, argv);
+
+  g_source.resize(kFramesCount * kChannels);
+  for (am_size i = 0; i < g_source.size(); ++i)
+    g_source[i] = static_cast<float>(i % 1024) / 1024.0f - 0.5f;
+
+  am_codec_decoder_vtable v_table = am_codec_decoder_vtable_init();
+  v_table.open = synth_open;
+  v_table.close = synth_close;
+  v_table.get_format = synth_get_format;
+  v_table.load = synth_load;
+  v_table.stream = synth_stream;
+  v_table.seek = synth_seek;
+
+  static Synth synths[] = {
+      {"bench_memset", SynthKind::Memset},
+      {"bench_memcpy", SynthKind::Memcpy},
+      {"bench_sine", SynthKind::Sine},
+  };
+
+  for (auto &synth : synths) {
+    am_codec_config codec = am_codec_config_init(synth.name);
+    codec.decoder.v_table = &v_table;
+    codec.decoder.user_data = &synth;
+    am_codec_register(&codec);
+  }
+
+  am_file_config file_config = am_file_config_init_memory();
+  am_file_handle file = am_file_create(&file_config);
+
+  for (const auto &synth : synths)
+    bench_synth(harness, synth, file);
+
+  am_file_destroy(file);
+  for (const auto &synth : synths)
+    am_codec_unregister(synth.name);
+
+  am_shutdown();
+
+  return harness.Finish();
+}
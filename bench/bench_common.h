@@ -0,0 +1,130 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_BENCH_COMMON_H
+#define _AM_BENCH_COMMON_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <amplitude.h>
+
+/**
+ * @brief Minimal memory allocator backing the Amplitude memory manager in benchmarks.
+ *
+ * Every block is over-aligned and prefixed with its size and original address, so aligned
+ * and unaligned allocations can be released and reallocated through the same callbacks.
+ */
+namespace bench
+{
+    struct BlockHeader
+    {
+        void* base;
+        am_size size;
+    };
+
+    inline am_voidptr
+    malign(am_memory_pool_kind, am_size size, am_uint32 alignment)
+    {
+        if (alignment < alignof(BlockHeader))
+            alignment = alignof(BlockHeader);
+
+        auto* base = static_cast<unsigned char*>(std::malloc(size + alignment + sizeof(BlockHeader)));
+        if (!base)
+            return nullptr;
+
+        auto address = reinterpret_cast<std::uintptr_t>(base + sizeof(BlockHeader));
+        address = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+        auto* header = reinterpret_cast<BlockHeader*>(address) - 1;
+        header->base = base;
+        header->size = size;
+
+        return reinterpret_cast<am_voidptr>(address);
+    }
+
+    inline am_voidptr
+    malloc(am_memory_pool_kind pool, am_size size)
+    {
+        return malign(pool, size, 16);
+    }
+
+    inline void
+    free(am_memory_pool_kind, am_voidptr address)
+    {
+        if (address)
+            std::free((static_cast<BlockHeader*>(address) - 1)->base);
+    }
+
+    inline am_size
+    size_of(am_memory_pool_kind, const am_voidptr address)
+    {
+        return address ? (static_cast<const BlockHeader*>(address) - 1)->size : 0;
+    }
+
+    inline am_voidptr
+    realign(am_memory_pool_kind pool, am_voidptr address, am_size size, am_uint32 alignment)
+    {
+        am_voidptr result = malign(pool, size, alignment);
+        if (result && address)
+        {
+            const am_size old_size = size_of(pool, address);
+            std::memcpy(result, address, old_size < size ? old_size : size);
+            free(pool, address);
+        }
+
+        return result;
+    }
+
+    inline am_voidptr
+    realloc(am_memory_pool_kind pool, am_voidptr address, am_size size)
+    {
+        return realign(pool, address, size, 16);
+    }
+
+    inline am_size
+    total_reserved_memory_size()
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Initializes the Amplitude memory manager with the benchmark allocator.
+     */
+    inline void
+    initialize_memory()
+    {
+        static am_memory_allocator_vtable v_table = {
+            malloc, realloc, malign, realign, free, total_reserved_memory_size, size_of,
+        };
+
+        if (!am_memory_manager_is_initialized())
+            am_memory_manager_initialize(&v_table);
+    }
+
+    /**
+     * @brief Gets the number of seconds elapsed since the given time point.
+     */
+    inline double
+    seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+} // namespace bench
+
+#endif // _AM_BENCH_COMMON_H
@@ -0,0 +1,75 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_BENCH_ENGINE_H
+#define _AM_BENCH_ENGINE_H
+
+#include <cstring>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+/**
+ * @brief Engine lifetime helpers for the tools which need entities, listeners or buses.
+ *
+ * The C API has no engine entry points yet, so the engine is driven through the SDK directly.
+ */
+namespace bench
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    inline AmOsString
+    to_os_string(const char* str)
+    {
+        return AmOsString(str, str + std::strlen(str));
+    }
+
+    /**
+     * @brief Opens the filesystem and initializes the engine with the given configuration file.
+     *
+     * @param[in] filesystem The filesystem to load assets from. Must outlive the engine.
+     * @param[in] config The path of the engine configuration, relative to the assets directory.
+     * @param[in] assets The assets directory, or nullptr for the working directory.
+     */
+    inline bool
+    start_engine(DiskFileSystem& filesystem, const char* config, const char* assets)
+    {
+        filesystem.SetBasePath(to_os_string(assets ? assets : "."));
+
+        amEngine->SetFileSystem(&filesystem);
+        amEngine->StartOpenFileSystem();
+        while (!amEngine->TryFinalizeOpenFileSystem())
+            Thread::Sleep(1);
+
+        Engine::RegisterDefaultPlugins();
+        return amEngine->Initialize(to_os_string(config));
+    }
+
+    /**
+     * @brief Deinitializes the engine started with start_engine().
+     */
+    inline void
+    stop_engine()
+    {
+        amEngine->Deinitialize();
+        amEngine->StartCloseFileSystem();
+        while (!amEngine->TryFinalizeCloseFileSystem())
+            Thread::Sleep(1);
+
+        Engine::UnregisterDefaultPlugins();
+    }
+} // namespace bench
+
+#endif // _AM_BENCH_ENGINE_H
@@ -0,0 +1,301 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_BENCH_HARNESS_H
+#define _AM_BENCH_HARNESS_H
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace bench
+{
+    /**
+     * @brief Prevents the compiler from optimizing away the computation of the given value.
+     */
+    template<typename T>
+    inline void
+    do_not_optimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        const volatile auto* sink = &value;
+        (void)sink;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /**
+     * @brief The measurements of a single benchmark.
+     */
+    struct Result
+    {
+        std::string name;
+        am_uint64 iterations;
+        double ns_per_op;
+        double min_ns_per_op;
+        double max_ns_per_op;
+        double items_per_second;
+        std::string skipped;
+    };
+
+    /**
+     * @brief Self-contained microbenchmark runner.
+     *
+     * Each benchmark is a function running a given number of iterations. The iteration count is
+     * calibrated until a single run lasts at least the minimum time, then the benchmark is repeated
+     * and the median, fastest and slowest runs are reported.
+     *
+     * Recognized command line options:
+     * - @c --json <path> writes the results as JSON to the given file ("-" for stdout).
+     * - @c --filter <text> only runs benchmarks whose name contains the given text.
+     * - @c --min-time <seconds> sets the minimum duration of a single run (default 0.1).
+     * - @c --repetitions <count> sets the number of measured runs (default 5).
+     *
+     * Other options are kept and can be read with @c GetOption().
+     */
+    class Harness
+    {
+    public:
+        /**
+         * @brief A benchmark body, running the given number of iterations.
+         */
+        using Function = std::function<void(am_uint64 iterations)>;
+
+        Harness(int argc, char** argv)
+            : _min_time(0.1)
+            , _repetitions(5)
+        {
+            for (int i = 1; i + 1 < argc; i += 2)
+            {
+                const std::string key = argv[i];
+                const char* value = argv[i + 1];
+
+                if (key == "--json")
+                    _json_path = value;
+                else if (key == "--filter")
+                    _filter = value;
+                else if (key == "--min-time")
+                    _min_time = std::max(std::atof(value), 0.001);
+                else if (key == "--repetitions")
+                    _repetitions = std::max(std::atoi(value), 1);
+                else
+                    _options.emplace_back(key, value);
+            }
+        }
+
+        /**
+         * @brief Gets the value of an extra command line option, or nullptr if it was not given.
+         *
+         * @param[in] name The option name, including the leading dashes.
+         */
+        [[nodiscard]] const char*
+        GetOption(const char* name) const
+        {
+            for (const auto& [key, value] : _options)
+                if (key == name)
+                    return value.c_str();
+
+            return nullptr;
+        }
+
+        /**
+         * @brief Checks whether the benchmark with the given name passes the filter.
+         */
+        [[nodiscard]] bool
+        IsEnabled(const char* name) const
+        {
+            return _filter.empty() || std::string(name).find(_filter) != std::string::npos;
+        }
+
+        /**
+         * @brief Runs a benchmark.
+         *
+         * @param[in] name The benchmark name, usually "family/operation".
+         * @param[in] function The benchmark body.
+         * @param[in] items_per_iteration The number of items (frames, bytes...) processed per iteration.
+         *
+         * @return The measurements, or nullptr if the benchmark was filtered out.
+         */
+        const Result*
+        Run(const char* name, const Function& function, am_uint64 items_per_iteration = 1)
+        {
+            if (!IsEnabled(name))
+                return nullptr;
+
+            // Grow the iteration count until a run is long enough to be timed reliably
+            am_uint64 iterations = 1;
+            double elapsed = Time(function, iterations);
+            while (elapsed < _min_time && iterations < (1ull << 40))
+            {
+                const double scale = elapsed > 0.0 ? _min_time * 1.2 / elapsed : 10.0;
+                iterations = static_cast<am_uint64>(static_cast<double>(iterations) * std::clamp(scale, 1.5, 10.0));
+                elapsed = Time(function, iterations);
+            }
+
+            std::vector<double> samples;
+            samples.reserve(_repetitions);
+            for (int i = 0; i < _repetitions; ++i)
+                samples.push_back(Time(function, iterations) * 1e9 / static_cast<double>(iterations));
+
+            std::sort(samples.begin(), samples.end());
+
+            Result result;
+            result.name = name;
+            result.iterations = iterations;
+            result.ns_per_op = samples[samples.size() / 2];
+            result.min_ns_per_op = samples.front();
+            result.max_ns_per_op = samples.back();
+            result.items_per_second = static_cast<double>(items_per_iteration) * 1e9 / result.ns_per_op;
+
+            std::fprintf(
+                stderr, "%-40s %14.2f ns %14.2f ns %14.2f ns %16.0f items/s\n", name, result.ns_per_op, result.min_ns_per_op,
+                result.max_ns_per_op, result.items_per_second);
+
+            _results.push_back(std::move(result));
+            return &_results.back();
+        }
+
+        /**
+         * @brief Records a value derived from other benchmarks, such as an overhead.
+         *
+         * @param[in] name The metric name.
+         * @param[in] value The metric value.
+         * @param[in] unit The unit of the value.
+         */
+        void
+        AddMetric(const char* name, double value, const char* unit)
+        {
+            std::fprintf(stderr, "%-40s %14.2f %s\n", name, value, unit);
+            _metrics.push_back({ name, unit, value });
+        }
+
+        /**
+         * @brief Records a benchmark that could not run.
+         *
+         * @param[in] name The benchmark name.
+         * @param[in] reason Why the benchmark was skipped.
+         */
+        void
+        Skip(const char* name, const char* reason)
+        {
+            if (!IsEnabled(name))
+                return;
+
+            std::fprintf(stderr, "%-40s skipped: %s\n", name, reason);
+
+            Result result = {};
+            result.name = name;
+            result.skipped = reason;
+            _results.push_back(std::move(result));
+        }
+
+        /**
+         * @brief Writes the JSON report, if requested.
+         *
+         * @return The process exit code.
+         */
+        int
+        Finish() const
+        {
+            if (_json_path.empty())
+                return 0;
+
+            FILE* out = _json_path == "-" ? stdout : std::fopen(_json_path.c_str(), "w");
+            if (!out)
+            {
+                std::fprintf(stderr, "Unable to open %s\n", _json_path.c_str());
+                return 1;
+            }
+
+            std::fprintf(out, "{\n  \"context\": {\n");
+            std::fprintf(out, "    \"min_time\": %g,\n    \"repetitions\": %d\n  },\n", _min_time, _repetitions);
+            std::fprintf(out, "  \"benchmarks\": [");
+
+            for (size_t i = 0; i < _results.size(); ++i)
+            {
+                const Result& result = _results[i];
+                std::fprintf(out, "%s\n    {\"name\": \"%s\", ", i == 0 ? "" : ",", result.name.c_str());
+
+                if (!result.skipped.empty())
+                {
+                    std::fprintf(out, "\"skipped\": true, \"reason\": \"%s\"}", result.skipped.c_str());
+                    continue;
+                }
+
+                std::fprintf(
+                    out,
+                    "\"iterations\": %llu, \"real_time\": %.3f, \"min_time\": %.3f, \"max_time\": %.3f, "
+                    "\"time_unit\": \"ns\", \"items_per_second\": %.1f}",
+                    static_cast<unsigned long long>(result.iterations), result.ns_per_op, result.min_ns_per_op,
+                    result.max_ns_per_op, result.items_per_second);
+            }
+
+            std::fprintf(out, "\n  ]");
+
+            if (!_metrics.empty())
+            {
+                std::fprintf(out, ",\n  \"metrics\": [");
+                for (size_t i = 0; i < _metrics.size(); ++i)
+                {
+                    const Metric& metric = _metrics[i];
+                    std::fprintf(
+                        out, "%s\n    {\"name\": \"%s\", \"value\": %.3f, \"unit\": \"%s\"}", i == 0 ? "" : ",",
+                        metric.name.c_str(), metric.value, metric.unit.c_str());
+                }
+                std::fprintf(out, "\n  ]");
+            }
+
+            std::fprintf(out, "\n}\n");
+
+            if (out != stdout)
+                std::fclose(out);
+
+            return 0;
+        }
+
+    private:
+        struct Metric
+        {
+            std::string name;
+            std::string unit;
+            double value;
+        };
+
+        static double
+        Time(const Function& function, am_uint64 iterations)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function(iterations);
+            return seconds_since(start);
+        }
+
+        std::string _json_path;
+        std::string _filter;
+        double _min_time;
+        int _repetitions;
+        std::vector<std::pair<std::string, std::string>> _options;
+        std::deque<Result> _results;
+        std::vector<Metric> _metrics;
+    };
+} // namespace bench
+
+#endif // _AM_BENCH_HARNESS_H
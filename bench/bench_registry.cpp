@@ -0,0 +1,331 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Stress test and contention benchmark for the handle registry.
+//
+// Worker threads run a mix of Get, GetMany, Store and Remove calls against a
+// shared SharedPtrManager, the way game, audio and I/O threads use it. Every
+// result is checked while running: shared handles must always resolve to the
+// right object, handles must never resolve with the wrong type, and stores and
+// removes of thread-owned handles must succeed. The process exits with a non
+// zero code if any check failed.
+//
+// Usage: amplitude_c_bench_registry [--threads <n,n,...>] [--duration <seconds>]
+//                                   [--handles <count>] [--workload <name>]
+//                                   [--json <path>]
+//
+// Workloads are "read" (99% Get), "churn" (50% Store/Remove), "batch" (GetMany
+// of 16 handles) and "all" (the default).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "amplitude_shared_ptr_manager.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t kOwnedSlots = 32;
+static constexpr size_t kBatchSize = 16;
+static constexpr uint64_t kSampleEvery = 64;
+
+struct Payload {
+  uint64_t value;
+};
+
+struct OtherPayload {
+  uint64_t value;
+};
+
+struct Workload {
+  const char *name;
+  // Percentage of operations storing or removing a thread-owned handle
+  uint32_t write_percent;
+  // Whether reads resolve a batch of handles under one lock
+  bool batched;
+};
+
+struct Config {
+  std::vector<uint32_t> threads;
+  double duration = 1.0;
+  size_t handles = 1024;
+  std::string workload = "all";
+  std::string json_path;
+};
+
+struct WorkerResult {
+  uint64_t ops = 0;
+  uint64_t failures = 0;
+  std::vector<uint32_t> samples;
+};
+
+struct RunResult {
+  std::string workload;
+  uint32_t threads;
+  double ops_per_second;
+  double p50_ns;
+  double p99_ns;
+  double max_ns;
+  uint64_t failures;
+};
+
+static uint64_t next_random(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static void run_worker(const Workload &workload,
+                       const std::vector<Payload *> &shared,
+                       const std::atomic<bool> &stop, WorkerResult &result,
+                       uint64_t seed) {
+  auto &manager = SharedPtrManager::Instance();
+
+  std::vector<std::shared_ptr<Payload>> owned(kOwnedSlots);
+  std::vector<Payload *> batch(kBatchSize);
+  std::vector<std::shared_ptr<Payload>> resolved(kBatchSize);
+
+  uint64_t state = seed | 1;
+
+  while (!stop.load(std::memory_order_relaxed)) {
+    for (int n = 0; n < 256; ++n) {
+      const uint64_t random = next_random(state);
+      const bool sampled = result.ops % kSampleEvery == 0;
+      const auto start = sampled ? Clock::now() : Clock::time_point();
+
+      if (random % 100 < workload.write_percent) {
+        auto &slot = owned[(random >> 8) % kOwnedSlots];
+        if (slot) {
+          if (!manager.Remove<Payload>(slot.get()))
+            ++result.failures;
+          slot.reset();
+        } else {
+          slot = std::make_shared<Payload>(Payload{random});
+          if (manager.Store<Payload>(slot) != slot.get())
+            ++result.failures;
+        }
+      } else if (workload.batched) {
+        for (size_t i = 0; i < kBatchSize; ++i)
+          batch[i] = shared[(random + i * 7919) % shared.size()];
+
+        if (manager.GetMany<Payload>(batch.data(), resolved.data(),
+                                     kBatchSize) != kBatchSize)
+          ++result.failures;
+      } else {
+        const size_t index = (random >> 8) % shared.size();
+        const auto payload = manager.Get<Payload>(shared[index]);
+        if (!payload || payload->value != index)
+          ++result.failures;
+
+        // A handle must never resolve as another type
+        if (random % 64 == 0 &&
+            manager.Get<OtherPayload>(
+                reinterpret_cast<OtherPayload *>(shared[index])))
+          ++result.failures;
+      }
+
+      if (sampled) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - start);
+        result.samples.push_back(static_cast<uint32_t>(
+            std::min<int64_t>(elapsed.count(), UINT32_MAX)));
+      }
+
+      ++result.ops;
+    }
+  }
+
+  for (auto &slot : owned) {
+    if (slot && !manager.Remove<Payload>(slot.get()))
+      ++result.failures;
+  }
+}
+
+static RunResult run(const Config &config, const Workload &workload,
+                     uint32_t thread_count) {
+  auto &manager = SharedPtrManager::Instance();
+
+  std::vector<std::shared_ptr<Payload>> objects(config.handles);
+  std::vector<Payload *> shared(config.handles);
+  for (size_t i = 0; i < config.handles; ++i) {
+    objects[i] = std::make_shared<Payload>(Payload{i});
+    shared[i] = manager.Store<Payload>(objects[i]);
+  }
+
+  std::atomic<bool> stop = false;
+  std::vector<WorkerResult> results(thread_count);
+  std::vector<std::thread> threads;
+
+  const auto start = Clock::now();
+  for (uint32_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back(run_worker, std::cref(workload), std::cref(shared),
+                         std::cref(stop), std::ref(results[t]),
+                         0x9E3779B97F4A7C15ull * (t + 1));
+  }
+
+  std::this_thread::sleep_for(std::chrono::duration<double>(config.duration));
+  stop = true;
+
+  for (auto &thread : threads)
+    thread.join();
+
+  const double elapsed =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  RunResult run = {workload.name, thread_count, 0.0, 0.0, 0.0, 0.0, 0};
+
+  std::vector<uint32_t> samples;
+  uint64_t ops = 0;
+  for (const auto &result : results) {
+    ops += result.ops;
+    run.failures += result.failures;
+    samples.insert(samples.end(), result.samples.begin(), result.samples.end());
+  }
+
+  for (auto *handle : shared) {
+    if (!manager.Remove<Payload>(handle))
+      ++run.failures;
+  }
+
+  if (manager.GetStoredCount() != 0)
+    ++run.failures;
+
+  run.ops_per_second = static_cast<double>(ops) / elapsed;
+
+  if (!samples.empty()) {
+    std::sort(samples.begin(), samples.end());
+    run.p50_ns = samples[samples.size() / 2];
+    run.p99_ns = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    run.max_ns = samples.back();
+  }
+
+  return run;
+}
+
+static std::vector<uint32_t> parse_threads(const char *list) {
+  std::vector<uint32_t> threads;
+  for (const char *p = list; *p;) {
+    const uint32_t count = static_cast<uint32_t>(std::strtoul(p, nullptr, 10));
+    if (count > 0)
+      threads.push_back(count);
+
+    p = std::strchr(p, ',');
+    if (!p)
+      break;
+    ++p;
+  }
+
+  return threads;
+}
+
+static bool write_json(const Config &config,
+                       const std::vector<RunResult> &runs) {
+  FILE *out = config.json_path == "-" ? stdout
+                                      : std::fopen(config.json_path.c_str(), "w");
+  if (!out)
+    return false;
+
+  std::fprintf(out, "{\n  \"context\": {\"duration\": %g, \"handles\": %zu},\n",
+               config.duration, config.handles);
+  std::fprintf(out, "  \"runs\": [");
+
+  for (size_t i = 0; i < runs.size(); ++i) {
+    const RunResult &run = runs[i];
+    std::fprintf(out,
+                 "%s\n    {\"workload\": \"%s\", \"threads\": %u, "
+                 "\"ops_per_second\": %.1f, \"p50_ns\": %.0f, \"p99_ns\": %.0f, "
+                 "\"max_ns\": %.0f, \"failures\": %llu}",
+                 i == 0 ? "" : ",", run.workload.c_str(), run.threads,
+                 run.ops_per_second, run.p50_ns, run.p99_ns, run.max_ns,
+                 static_cast<unsigned long long>(run.failures));
+  }
+
+  std::fprintf(out, "\n  ]\n}\n");
+
+  if (out != stdout)
+    std::fclose(out);
+
+  return true;
+}
+
+int main(int argc, char **argv) {
+  Config config;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+
+    if (key == "--threads")
+      config.threads = parse_threads(value);
+    else if (key == "--duration")
+      config.duration = std::max(std::atof(value), 0.01);
+    else if (key == "--handles")
+      config.handles = std::max<size_t>(std::strtoull(value, nullptr, 10), 1);
+    else if (key == "--workload")
+      config.workload = value;
+    else if (key == "--json")
+      config.json_path = value;
+  }
+
+  if (config.threads.empty()) {
+    const uint32_t hardware =
+        std::max(std::thread::hardware_concurrency(), 1u);
+    for (uint32_t count = 1; count < hardware; count *= 2)
+      config.threads.push_back(count);
+    config.threads.push_back(hardware);
+  }
+
+  const Workload workloads[] = {
+      {"read", 1, false},
+      {"churn", 50, false},
+      {"batch", 1, true},
+  };
+
+  std::vector<RunResult> runs;
+  uint64_t failures = 0;
+
+  std::printf("%-8s %8s %16s %10s %10s %10s %10s\n", "workload", "threads",
+              "ops/s", "p50 (ns)", "p99 (ns)", "max (ns)", "failures");
+
+  for (const auto &workload : workloads) {
+    if (config.workload != "all" && config.workload != workload.name)
+      continue;
+
+    for (const uint32_t threads : config.threads) {
+      const RunResult result = run(config, workload, threads);
+      std::printf("%-8s %8u %16.0f %10.0f %10.0f %10.0f %10llu\n",
+                  result.workload.c_str(), result.threads,
+                  result.ops_per_second, result.p50_ns, result.p99_ns,
+                  result.max_ns,
+                  static_cast<unsigned long long>(result.failures));
+
+      failures += result.failures;
+      runs.push_back(result);
+    }
+  }
+
+  if (!config.json_path.empty() && !write_json(config, runs)) {
+    std::fprintf(stderr, "Unable to open %s\n", config.json_path.c_str());
+    return 1;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
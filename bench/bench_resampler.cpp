@@ -0,0 +1,238 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the quality and the CPU cost of the sample rate converter.
+//
+// Quality is reported as the signal to noise ratio of a converted 1 kHz sine
+// against the ideal sine at the target rate, and as the level of a tone above
+// the target Nyquist frequency that should have been filtered out.
+//
+// Every conversion must also produce exactly the number of frames announced by
+// the resampler format, otherwise the bench exits with an error. Conversions
+// with a ratio above the filter length make the filter skip source frames.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "bench_common.h"
+
+static constexpr double kPi = 3.14159265358979323846;
+static constexpr am_uint64 kBlockSize = 512;
+
+struct SineSource {
+  am_uint32 sample_rate;
+  am_uint16 num_channels;
+  am_uint64 frames_count;
+  double frequency;
+};
+
+static SineSource g_source;
+
+static am_bool sine_open(am_voidptr, am_file_handle) { return AM_TRUE; }
+
+static am_bool sine_close(am_voidptr) { return AM_TRUE; }
+
+static void sine_get_format(am_voidptr, am_sound_format *format) {
+  am_sound_format_set_all(format, g_source.sample_rate, g_source.num_channels,
+                          32, g_source.frames_count,
+                          sizeof(float) * g_source.num_channels,
+                          am_audio_sample_format_float32);
+}
+
+static am_uint64 sine_stream(am_voidptr, am_voidptr out,
+                             am_uint64 buffer_offset, am_uint64 seek_offset,
+                             am_uint64 length) {
+  auto *dst = static_cast<float *>(out) + buffer_offset * g_source.num_channels;
+  const double step = 2.0 * kPi * g_source.frequency / g_source.sample_rate;
+
+  am_uint64 frames = 0;
+  for (; frames < length && seek_offset + frames < g_source.frames_count;
+       ++frames) {
+    const auto value =
+        static_cast<float>(0.5 * std::sin(step * (seek_offset + frames)));
+    for (am_uint16 c = 0; c < g_source.num_channels; ++c)
+      *dst++ = value;
+  }
+
+  return frames;
+}
+
+static am_bool sine_seek(am_voidptr, am_uint64) { return AM_TRUE; }
+
+struct Result {
+  am_uint64 expected;
+  am_uint64 frames;
+  double seconds;
+  std::vector<float> samples;
+};
+
+static Result run(am_file_handle file, am_uint32 target_rate,
+                  am_resampler_quality quality, am_uint32 filter_length) {
+  Result result = {0, 0, 0.0, {}};
+
+  am_codec_decoder_handle decoder = am_codec_decoder_create("bench_sine");
+  if (!decoder || !am_codec_decoder_open(decoder, file))
+    return result;
+
+  am_codec_resampler_config config = am_codec_resampler_config_init(target_rate);
+  config.quality = quality;
+  config.filter_length = filter_length;
+
+  am_codec_resampler_handle resampler =
+      am_codec_resampler_create(decoder, &config);
+
+  if (resampler) {
+    am_sound_format format;
+    am_codec_resampler_get_format(resampler, &format);
+    result.expected = format.frames_count;
+
+    // Room for one extra block, so that producing too many frames is caught
+    result.samples.resize((format.frames_count + kBlockSize) *
+                          format.num_channels);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    am_uint64 read = 0;
+    while ((read = am_codec_resampler_stream(resampler, result.samples.data(),
+                                             result.frames, result.frames,
+                                             kBlockSize)) > 0)
+      result.frames += read;
+
+    result.seconds = bench::seconds_since(start);
+    am_codec_resampler_destroy(resampler);
+  }
+
+  am_codec_decoder_close(decoder);
+  am_codec_decoder_destroy(decoder);
+
+  return result;
+}
+
+// Signal to noise ratio against the ideal sine, skipping the filter edges
+static double measure_snr(const Result &result, am_uint32 target_rate) {
+  const double step = 2.0 * kPi * g_source.frequency / target_rate;
+  double signal = 0.0;
+  double noise = 0.0;
+
+  for (am_uint64 i = 256; i + 256 < result.frames; ++i) {
+    const double expected = 0.5 * std::sin(step * i);
+    const double error =
+        result.samples[i * g_source.num_channels] - expected;
+    signal += expected * expected;
+    noise += error * error;
+  }
+
+  return 10.0 * std::log10(signal / std::max(noise, 1e-30));
+}
+
+// Level of the output relative to the input, in dB
+static double measure_level(const Result &result) {
+  double energy = 0.0;
+
+  for (am_uint64 i = 256; i + 256 < result.frames; ++i) {
+    const double value = result.samples[i * g_source.num_channels];
+    energy += value * value;
+  }
+
+  const double rms = std::sqrt(energy / std::max<am_uint64>(result.frames - 512, 1));
+  return 20.0 * std::log10(std::max(rms / (0.5 / std::sqrt(2.0)), 1e-12));
+}
+
+int main() {
+  bench::initialize_memory();
+  am_boot();
+
+  am_codec_decoder_vtable decoder_v_table = am_codec_decoder_vtable_init();
+  decoder_v_table.open = sine_open;
+  decoder_v_table.close = sine_close;
+  decoder_v_table.get_format = sine_get_format;
+  decoder_v_table.stream = sine_stream;
+  decoder_v_table.seek = sine_seek;
+
+  am_codec_config codec = am_codec_config_init("bench_sine");
+  codec.decoder.v_table = &decoder_v_table;
+  am_codec_register(&codec);
+
+  am_file_config file_config = am_file_config_init_memory();
+  am_file_handle file = am_file_create(&file_config);
+
+  struct Mode {
+    const char *name;
+    am_resampler_quality quality;
+    am_uint32 filter_length;
+  };
+
+  const Mode modes[] = {
+      {"linear", am_resampler_quality_linear, 0},
+      {"sinc-16", am_resampler_quality_sinc, 16},
+      {"sinc-32", am_resampler_quality_sinc, 32},
+      {"sinc-64", am_resampler_quality_sinc, 64},
+  };
+
+  const am_uint32 conversions[][2] = {{48000, 44100}, {44100, 48000},
+                                      {96000, 48000}, {96000, 44100},
+                                      {192000, 8000}};
+
+  std::printf("%-8s %-14s %10s %12s %14s %12s\n", "mode", "conversion",
+              "SNR (dB)", "alias (dB)", "frames/s", "x realtime");
+
+  bool failed = false;
+
+  for (const auto &mode : modes) {
+    for (const auto &conversion : conversions) {
+      g_source.sample_rate = conversion[0];
+      g_source.num_channels = 2;
+      g_source.frames_count = conversion[0] * 10;
+
+      // Quality of a tone well inside the passband
+      g_source.frequency = 1000.0;
+      const Result sine = run(file, conversion[1], mode.quality,
+                              mode.filter_length);
+
+      // Rejection of a tone above the target Nyquist frequency, when
+      // downsampling
+      double alias = 0.0;
+      if (conversion[1] < conversion[0]) {
+        g_source.frequency = conversion[1] * 0.5 + 2000.0;
+        alias = measure_level(run(file, conversion[1], mode.quality,
+                                  mode.filter_length));
+      }
+
+      char label[32];
+      std::snprintf(label, sizeof(label), "%u->%u", conversion[0],
+                    conversion[1]);
+
+      const double frames_per_second = sine.frames / sine.seconds;
+      std::printf("%-8s %-14s %10.1f %12.1f %14.0f %12.1f\n", mode.name, label,
+                  measure_snr(sine, conversion[1]), alias, frames_per_second,
+                  frames_per_second / conversion[1]);
+
+      if (sine.frames != sine.expected) {
+        std::printf("error: %s %s produced %llu frames, expected %llu\n",
+                    mode.name, label,
+                    static_cast<unsigned long long>(sine.frames),
+                    static_cast<unsigned long long>(sine.expected));
+        failed = true;
+      }
+    }
+  }
+
+  am_file_destroy(file);
+  am_codec_unregister("bench_sine");
+  am_shutdown();
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,895 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays a C API capture recorded with am_capture_start().
+//
+// Usage: amplitude_c_replay <capture> [--engine-config <path>]
+//                           [--assets <directory>] [--realtime 0|1]
+//                           [--repeat <count>]
+//
+// Calls are re-issued as fast as possible, or with their recorded timing when
+// --realtime is 1. Entities, listeners, environments and rooms are recreated
+// from their recorded identifiers, and buses are looked up by identifier.
+// Channels cannot be recreated outside of a game session, so channel calls are
+// skipped, and so are the calls giving a zone or a box shape, which are built
+// by the application. The raycast callback of the application is not recorded
+// either: replayed raycast updates cast their rays with a callback reporting
+// clear paths, so the service scheduling is replayed but not the ray costs.
+//
+// Without an engine configuration, the capture is only decoded and summarized.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/amplitude_capture.h"
+#include "bench_common.h"
+#include "bench_engine.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+class CaptureReader {
+public:
+  explicit CaptureReader(std::vector<AmUInt8> data)
+      : _data(std::move(data)), _position(0) {}
+
+  [[nodiscard]] bool AtEnd() const { return _position >= _data.size(); }
+
+  [[nodiscard]] bool Failed() const { return _failed; }
+
+  void Fail() {
+    _failed = true;
+    _position = _data.size();
+  }
+
+  std::string ReadString() {
+    const AmUInt64 length = ReadVarint();
+    if (length > _data.size() - _position) {
+      Fail();
+      return {};
+    }
+
+    std::string value(reinterpret_cast<const char *>(_data.data()) + _position,
+                      length);
+    _position += length;
+    return value;
+  }
+
+  AmUInt64 ReadVarint() {
+    AmUInt64 value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const AmUInt8 byte = Read<AmUInt8>();
+      value |= static_cast<AmUInt64>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+        break;
+    }
+
+    return value;
+  }
+
+  template <typename T> T Read() {
+    T value = {};
+    if (_position + sizeof(T) > _data.size()) {
+      Fail();
+      return value;
+    }
+
+    std::memcpy(&value, _data.data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+private:
+  std::vector<AmUInt8> _data;
+  size_t _position;
+  bool _failed = false;
+};
+
+struct Replay {
+  bool live = false;
+  bool realtime = false;
+
+  std::vector<void *> handles[kCaptureHandleKindCount];
+  AmUInt64 calls = 0;
+  AmUInt64 skipped = 0;
+  AmUInt64 recorded_ns = 0;
+  AmUInt64 per_call[kCaptureCallCount] = {};
+};
+
+static void define_handle(Replay &replay, CaptureHandleKind kind,
+                          AmUInt64 index, AmUInt64 id) {
+  auto &handles = replay.handles[static_cast<size_t>(kind)];
+  if (handles.size() <= index)
+    handles.resize(index + 1, nullptr);
+
+  if (!replay.live)
+    return;
+
+  switch (kind) {
+  case CaptureHandleKind::Entity:
+    handles[index] = am_entity_create(id);
+    break;
+  case CaptureHandleKind::Listener:
+    handles[index] = amEngine->AddListener(id).GetState();
+    break;
+  case CaptureHandleKind::Bus:
+    handles[index] = amEngine->FindBus(id).GetState();
+    break;
+  case CaptureHandleKind::Environment:
+    handles[index] = amEngine->AddEnvironment(id).GetState();
+    break;
+  case CaptureHandleKind::Room:
+    handles[index] = amEngine->AddRoom(id).GetState();
+    break;
+  case CaptureHandleKind::Channel:
+    break;
+  }
+}
+
+static void replay_raycast(const am_raycast_request *,
+                           am_raycast_result *results, am_size count,
+                           am_voidptr) {
+  for (am_size i = 0; i < count; ++i)
+    results[i] = {0.0f, 0.0f};
+}
+
+static void *read_handle(CaptureReader &reader, Replay &replay,
+                         CaptureHandleKind kind) {
+  const AmUInt64 index = reader.ReadVarint();
+  const auto &handles = replay.handles[static_cast<size_t>(kind)];
+  return index < handles.size() ? handles[index] : nullptr;
+}
+
+// Reads the arguments of a call and issues it. Returns false if the call is
+// unknown, or could not be issued because its handle is missing.
+static bool replay_call(CaptureReader &reader, Replay &replay,
+                        CaptureCall call) {
+#define ENTITY                                                                 \
+  reinterpret_cast<am_entity_handle>(                                          \
+      read_handle(reader, replay, CaptureHandleKind::Entity))
+#define LISTENER                                                               \
+  reinterpret_cast<am_listener_handle>(                                        \
+      read_handle(reader, replay, CaptureHandleKind::Listener))
+#define CHANNEL                                                                \
+  reinterpret_cast<am_channel_handle>(                                         \
+      read_handle(reader, replay, CaptureHandleKind::Channel))
+#define BUS                                                                    \
+  reinterpret_cast<am_bus_handle>(                                             \
+      read_handle(reader, replay, CaptureHandleKind::Bus))
+#define ENVIRONMENT                                                            \
+  reinterpret_cast<am_environment_handle>(                                     \
+      read_handle(reader, replay, CaptureHandleKind::Environment))
+#define ROOM                                                                   \
+  reinterpret_cast<am_room_handle>(                                            \
+      read_handle(reader, replay, CaptureHandleKind::Room))
+#define ARG(type) reader.Read<type>()
+#define ISSUE(handle, ...)                                                     \
+  do {                                                                         \
+    auto h = handle;                                                           \
+    if (!h || !replay.live)                                                    \
+      return false;                                                            \
+    __VA_ARGS__;                                                               \
+  } while (false)
+#define ISSUE_GLOBAL(...)                                                      \
+  do {                                                                         \
+    if (!replay.live)                                                          \
+      return false;                                                            \
+    __VA_ARGS__;                                                               \
+  } while (false)
+
+  switch (call) {
+  case CaptureCall::EntityIsValid:
+    ISSUE(ENTITY, am_entity_is_valid(h));
+    break;
+  case CaptureCall::EntityGetId:
+    ISSUE(ENTITY, am_entity_get_id(h));
+    break;
+  case CaptureCall::EntityGetVelocity:
+    ISSUE(ENTITY, am_entity_get_velocity(h));
+    break;
+  case CaptureCall::EntitySetLocation: {
+    auto handle = ENTITY;
+    const auto location = ARG(am_vec3);
+    ISSUE(handle, am_entity_set_location(h, location));
+    break;
+  }
+  case CaptureCall::EntityGetLocation:
+    ISSUE(ENTITY, am_entity_get_location(h));
+    break;
+  case CaptureCall::EntitySetOrientation: {
+    auto handle = ENTITY;
+    const auto orientation = ARG(am_quaternion);
+    ISSUE(handle, am_entity_set_orientation(h, orientation));
+    break;
+  }
+  case CaptureCall::EntityGetDirection:
+    ISSUE(ENTITY, am_entity_get_direction(h));
+    break;
+  case CaptureCall::EntityGetUp:
+    ISSUE(ENTITY, am_entity_get_up(h));
+    break;
+  case CaptureCall::EntityGetOrientation:
+    ISSUE(ENTITY, am_entity_get_orientation(h));
+    break;
+  case CaptureCall::EntitySetObstruction: {
+    auto handle = ENTITY;
+    const auto obstruction = ARG(am_float32);
+    ISSUE(handle, am_entity_set_obstruction(h, obstruction));
+    break;
+  }
+  case CaptureCall::EntitySetOcclusion: {
+    auto handle = ENTITY;
+    const auto occlusion = ARG(am_float32);
+    ISSUE(handle, am_entity_set_occlusion(h, occlusion));
+    break;
+  }
+  case CaptureCall::EntitySetDirectivity: {
+    auto handle = ENTITY;
+    const auto directivity = ARG(am_float32);
+    const auto sharpness = ARG(am_float32);
+    ISSUE(handle, am_entity_set_directivity(h, directivity, sharpness));
+    break;
+  }
+  case CaptureCall::EntityGetObstruction:
+    ISSUE(ENTITY, am_entity_get_obstruction(h));
+    break;
+  case CaptureCall::EntityGetOcclusion:
+    ISSUE(ENTITY, am_entity_get_occlusion(h));
+    break;
+  case CaptureCall::EntityGetDirectivity:
+    ISSUE(ENTITY, am_entity_get_directivity(h));
+    break;
+  case CaptureCall::EntityGetDirectivitySharpness:
+    ISSUE(ENTITY, am_entity_get_directivity_sharpness(h));
+    break;
+  case CaptureCall::EntitySetEnvironmentFactor: {
+    auto handle = ENTITY;
+    const auto environment = ARG(am_environment_id);
+    const auto factor = ARG(am_float32);
+    ISSUE(handle, am_entity_set_environment_factor(h, environment, factor));
+    break;
+  }
+  case CaptureCall::EntityGetEnvironmentFactor: {
+    auto handle = ENTITY;
+    const auto environment = ARG(am_environment_id);
+    ISSUE(handle, am_entity_get_environment_factor(h, environment));
+    break;
+  }
+  case CaptureCall::EntityGetActiveChannelCount:
+    ISSUE(ENTITY, am_entity_get_active_channel_count(h));
+    break;
+  case CaptureCall::EntitySetLocationAt: {
+    auto handle = ENTITY;
+    const auto location = ARG(am_vec3);
+    const auto time = ARG(am_time);
+    ISSUE(handle, am_entity_set_location_at(h, location, time));
+    break;
+  }
+  case CaptureCall::EntityGetTrackedVelocity:
+    ISSUE(ENTITY, am_entity_get_tracked_velocity(h));
+    break;
+  case CaptureCall::EntityResetVelocityTracking:
+    ISSUE(ENTITY, am_entity_reset_velocity_tracking(h));
+    break;
+  case CaptureCall::EntityCreate: {
+    const auto id = ARG(am_entity_id);
+    if (!replay.live)
+      return false;
+    am_entity_create(id);
+    break;
+  }
+  case CaptureCall::EntityDestroy: {
+    const AmUInt64 index = reader.ReadVarint();
+    auto &handles =
+        replay.handles[static_cast<size_t>(CaptureHandleKind::Entity)];
+    if (index >= handles.size() || !handles[index] || !replay.live)
+      return false;
+    am_entity_destroy(reinterpret_cast<am_entity_handle>(handles[index]));
+    handles[index] = nullptr;
+    break;
+  }
+  case CaptureCall::EntityGetCount:
+    ISSUE_GLOBAL(am_entity_get_count());
+    break;
+
+  case CaptureCall::ListenerIsValid:
+    ISSUE(LISTENER, am_listener_is_valid(h));
+    break;
+  case CaptureCall::ListenerGetId:
+    ISSUE(LISTENER, am_listener_get_id(h));
+    break;
+  case CaptureCall::ListenerGetVelocity:
+    ISSUE(LISTENER, am_listener_get_velocity(h));
+    break;
+  case CaptureCall::ListenerGetLocation:
+    ISSUE(LISTENER, am_listener_get_location(h));
+    break;
+  case CaptureCall::ListenerSetLocation: {
+    auto handle = LISTENER;
+    const auto location = ARG(am_vec3);
+    ISSUE(handle, am_listener_set_location(h, location));
+    break;
+  }
+  case CaptureCall::ListenerGetDirection:
+    ISSUE(LISTENER, am_listener_get_direction(h));
+    break;
+  case CaptureCall::ListenerGetUp:
+    ISSUE(LISTENER, am_listener_get_up(h));
+    break;
+  case CaptureCall::ListenerSetOrientation: {
+    auto handle = LISTENER;
+    const auto orientation = ARG(am_quaternion);
+    ISSUE(handle, am_listener_set_orientation(h, orientation));
+    break;
+  }
+  case CaptureCall::ListenerGetOrientation:
+    ISSUE(LISTENER, am_listener_get_orientation(h));
+    break;
+  case CaptureCall::ListenerSetDirectivity: {
+    auto handle = LISTENER;
+    const auto directivity = ARG(am_float32);
+    const auto sharpness = ARG(am_float32);
+    ISSUE(handle, am_listener_set_directivity(h, directivity, sharpness));
+    break;
+  }
+  case CaptureCall::ListenerGetDirectivity:
+    ISSUE(LISTENER, am_listener_get_directivity(h));
+    break;
+  case CaptureCall::ListenerGetDirectivitySharpness:
+    ISSUE(LISTENER, am_listener_get_directivity_sharpness(h));
+    break;
+  case CaptureCall::ListenerGetInverseMatrix:
+    ISSUE(LISTENER, am_listener_get_inverse_matrix(h));
+    break;
+  case CaptureCall::ListenerSetState: {
+    auto handle = LISTENER;
+    const auto location = ARG(am_vec3);
+    const auto orientation = ARG(am_quaternion);
+    const auto directivity = ARG(am_float32);
+    const auto sharpness = ARG(am_float32);
+    ISSUE(handle, am_listener_set_state(h, location, orientation, directivity,
+                                        sharpness));
+    break;
+  }
+  case CaptureCall::ListenerSetLocationAt: {
+    auto handle = LISTENER;
+    const auto location = ARG(am_vec3);
+    const auto time = ARG(am_time);
+    ISSUE(handle, am_listener_set_location_at(h, location, time));
+    break;
+  }
+  case CaptureCall::ListenerGetTrackedVelocity:
+    ISSUE(LISTENER, am_listener_get_tracked_velocity(h));
+    break;
+  case CaptureCall::ListenerResetVelocityTracking:
+    ISSUE(LISTENER, am_listener_reset_velocity_tracking(h));
+    break;
+
+  // Channels are never recreated, only their arguments are consumed
+  case CaptureCall::ChannelIsValid:
+  case CaptureCall::ChannelGetId:
+  case CaptureCall::ChannelPlaying:
+  case CaptureCall::ChannelStop:
+  case CaptureCall::ChannelPause:
+  case CaptureCall::ChannelResume:
+  case CaptureCall::ChannelGetLocation:
+  case CaptureCall::ChannelGetGain:
+  case CaptureCall::ChannelGetPlaybackState:
+    CHANNEL;
+    return false;
+  case CaptureCall::ChannelStopTimeout:
+  case CaptureCall::ChannelPauseTimeout:
+  case CaptureCall::ChannelResumeTimeout:
+    CHANNEL;
+    ARG(am_time);
+    return false;
+  case CaptureCall::ChannelSetLocation:
+    CHANNEL;
+    ARG(am_vec3);
+    return false;
+  case CaptureCall::ChannelSetGain:
+    CHANNEL;
+    ARG(am_float32);
+    return false;
+
+  case CaptureCall::BusIsValid:
+    ISSUE(BUS, am_bus_is_valid(h));
+    break;
+  case CaptureCall::BusGetId:
+    ISSUE(BUS, am_bus_get_id(h));
+    break;
+  case CaptureCall::BusGetName:
+    ISSUE(BUS, am_memory_free_str(am_bus_get_name(h)));
+    break;
+  case CaptureCall::BusSetGain: {
+    auto handle = BUS;
+    const auto gain = ARG(am_float32);
+    ISSUE(handle, am_bus_set_gain(h, gain));
+    break;
+  }
+  case CaptureCall::BusGetGain:
+    ISSUE(BUS, am_bus_get_gain(h));
+    break;
+  case CaptureCall::BusFadeTo: {
+    auto handle = BUS;
+    const auto gain = ARG(am_float32);
+    const auto duration = ARG(am_time);
+    ISSUE(handle, am_bus_fade_to(h, gain, duration));
+    break;
+  }
+  case CaptureCall::BusGetFinalGain:
+    ISSUE(BUS, am_bus_get_final_gain(h));
+    break;
+  case CaptureCall::BusSetMute: {
+    auto handle = BUS;
+    const auto mute = ARG(am_bool);
+    ISSUE(handle, am_bus_set_mute(h, mute));
+    break;
+  }
+  case CaptureCall::BusIsMuted:
+    ISSUE(BUS, am_bus_is_muted(h));
+    break;
+
+  case CaptureCall::EnvironmentIsValid:
+    ISSUE(ENVIRONMENT, am_environment_is_valid(h));
+    break;
+  case CaptureCall::EnvironmentGetId:
+    ISSUE(ENVIRONMENT, am_environment_get_id(h));
+    break;
+  case CaptureCall::EnvironmentSetLocation: {
+    auto handle = ENVIRONMENT;
+    const auto location = ARG(am_vec3);
+    ISSUE(handle, am_environment_set_location(h, location));
+    break;
+  }
+  case CaptureCall::EnvironmentGetLocation:
+    ISSUE(ENVIRONMENT, am_environment_get_location(h));
+    break;
+  case CaptureCall::EnvironmentSetOrientation: {
+    auto handle = ENVIRONMENT;
+    const auto orientation = ARG(am_quaternion);
+    ISSUE(handle, am_environment_set_orientation(h, orientation));
+    break;
+  }
+  case CaptureCall::EnvironmentGetOrientation:
+    ISSUE(ENVIRONMENT, am_environment_get_orientation(h));
+    break;
+  case CaptureCall::EnvironmentGetDirection:
+    ISSUE(ENVIRONMENT, am_environment_get_direction(h));
+    break;
+  case CaptureCall::EnvironmentGetUp:
+    ISSUE(ENVIRONMENT, am_environment_get_up(h));
+    break;
+  case CaptureCall::EnvironmentGetFactorForLocation: {
+    auto handle = ENVIRONMENT;
+    const auto location = ARG(am_vec3);
+    ISSUE(handle, am_environment_get_factor_for_location(h, location));
+    break;
+  }
+  case CaptureCall::EnvironmentGetFactorForEntity: {
+    auto handle = ENVIRONMENT;
+    auto entity = ENTITY;
+    if (!entity)
+      return false;
+    ISSUE(handle, am_environment_get_factor_for_entity(h, entity));
+    break;
+  }
+  case CaptureCall::EnvironmentSetEffectById:
+  // Effects given by handle are recorded by identifier
+  case CaptureCall::EnvironmentSetEffect: {
+    auto handle = ENVIRONMENT;
+    const auto effect = ARG(am_effect_id);
+    ISSUE(handle, am_environment_set_effect_by_id(h, effect));
+    break;
+  }
+  case CaptureCall::EnvironmentSetEffectByName: {
+    auto handle = ENVIRONMENT;
+    const std::string effect = reader.ReadString();
+    ISSUE(handle, am_environment_set_effect_by_name(h, effect.c_str()));
+    break;
+  }
+  case CaptureCall::EnvironmentGetEffect:
+    ISSUE(ENVIRONMENT, am_environment_get_effect(h));
+    break;
+  case CaptureCall::EnvironmentSetZone:
+    ENVIRONMENT;
+    return false;
+  case CaptureCall::EnvironmentGetZone:
+    ISSUE(ENVIRONMENT, am_environment_get_zone(h));
+    break;
+
+  case CaptureCall::RoomWallMaterialCreate:
+    ISSUE_GLOBAL(am_room_wall_material_create());
+    break;
+  case CaptureCall::RoomWallMaterialCreateWithType: {
+    const auto type = ARG(am_room_wall_material_type);
+    ISSUE_GLOBAL(am_room_wall_material_create_with_type(type));
+    break;
+  }
+  case CaptureCall::RoomIsValid:
+    ISSUE(ROOM, am_room_is_valid(h));
+    break;
+  case CaptureCall::RoomGetId:
+    ISSUE(ROOM, am_room_get_id(h));
+    break;
+  case CaptureCall::RoomSetLocation: {
+    auto handle = ROOM;
+    const auto location = ARG(am_vec3);
+    ISSUE(handle, am_room_set_location(h, location));
+    break;
+  }
+  case CaptureCall::RoomGetLocation:
+    ISSUE(ROOM, am_room_get_location(h));
+    break;
+  case CaptureCall::RoomSetOrientation: {
+    auto handle = ROOM;
+    const auto orientation = ARG(am_quaternion);
+    ISSUE(handle, am_room_set_orientation(h, orientation));
+    break;
+  }
+  case CaptureCall::RoomGetOrientation:
+    ISSUE(ROOM, am_room_get_orientation(h));
+    break;
+  case CaptureCall::RoomGetDirection:
+    ISSUE(ROOM, am_room_get_direction(h));
+    break;
+  case CaptureCall::RoomGetUp:
+    ISSUE(ROOM, am_room_get_up(h));
+    break;
+  case CaptureCall::RoomSetDimensions: {
+    auto handle = ROOM;
+    const auto dimensions = ARG(am_vec3);
+    ISSUE(handle, am_room_set_dimensions(h, dimensions));
+    break;
+  }
+  case CaptureCall::RoomSetShape:
+    ROOM;
+    return false;
+  case CaptureCall::RoomGetShape:
+    ISSUE(ROOM, am_room_get_shape(h));
+    break;
+  case CaptureCall::RoomSetWallMaterial: {
+    auto handle = ROOM;
+    const auto wall = ARG(am_room_wall);
+    const auto material = ARG(am_room_wall_material);
+    ISSUE(handle, am_room_set_wall_material(h, wall, material));
+    break;
+  }
+  case CaptureCall::RoomSetAllWallMaterials: {
+    auto handle = ROOM;
+    const auto material = ARG(am_room_wall_material);
+    ISSUE(handle, am_room_set_all_wall_materials(h, material));
+    break;
+  }
+  case CaptureCall::RoomSetWallMaterials: {
+    auto handle = ROOM;
+    am_room_wall_material materials[6];
+    for (auto &material : materials)
+      material = ARG(am_room_wall_material);
+    ISSUE(handle,
+          am_room_set_wall_materials(h, materials[0], materials[1],
+                                     materials[2], materials[3], materials[4],
+                                     materials[5]));
+    break;
+  }
+  case CaptureCall::RoomGetWallMaterial: {
+    auto handle = ROOM;
+    const auto wall = ARG(am_room_wall);
+    ISSUE(handle, am_room_get_wall_material(h, wall));
+    break;
+  }
+  case CaptureCall::RoomSetGain: {
+    auto handle = ROOM;
+    const auto gain = ARG(am_float32);
+    ISSUE(handle, am_room_set_gain(h, gain));
+    break;
+  }
+  case CaptureCall::RoomGetGain:
+    ISSUE(ROOM, am_room_get_gain(h));
+    break;
+  case CaptureCall::RoomGetVolume:
+    ISSUE(ROOM, am_room_get_volume(h));
+    break;
+  case CaptureCall::RoomGetDimensions:
+    ISSUE(ROOM, am_room_get_dimensions(h));
+    break;
+  case CaptureCall::RoomGetSurfaceArea: {
+    auto handle = ROOM;
+    const auto wall = ARG(am_room_wall);
+    ISSUE(handle, am_room_get_surface_area(h, wall));
+    break;
+  }
+
+  case CaptureCall::FrameSetSnapshotMode: {
+    const auto enabled = ARG(am_bool);
+    ISSUE_GLOBAL(am_frame_set_snapshot_mode(enabled));
+    break;
+  }
+  case CaptureCall::FrameIsSnapshotMode:
+    ISSUE_GLOBAL(am_frame_is_snapshot_mode());
+    break;
+  case CaptureCall::FrameCommit:
+    ISSUE_GLOBAL(am_frame_commit());
+    break;
+  case CaptureCall::FrameGetPendingCount:
+    ISSUE_GLOBAL(am_frame_get_pending_count());
+    break;
+
+  case CaptureCall::ChangeFilterSetEnabled: {
+    const auto enabled = ARG(am_bool);
+    ISSUE_GLOBAL(am_change_filter_set_enabled(enabled));
+    break;
+  }
+  case CaptureCall::ChangeFilterIsEnabled:
+    ISSUE_GLOBAL(am_change_filter_is_enabled());
+    break;
+  case CaptureCall::ChangeFilterSetConfig: {
+    const auto config = ARG(am_change_filter_config);
+    ISSUE_GLOBAL(am_change_filter_set_config(&config));
+    break;
+  }
+  case CaptureCall::ChangeFilterGetConfig: {
+    am_change_filter_config config;
+    ISSUE_GLOBAL(am_change_filter_get_config(&config));
+    break;
+  }
+  case CaptureCall::ChangeFilterGetStats: {
+    am_change_filter_stats stats;
+    ISSUE_GLOBAL(am_change_filter_get_stats(&stats));
+    break;
+  }
+  case CaptureCall::ChangeFilterResetStats:
+    ISSUE_GLOBAL(am_change_filter_reset_stats());
+    break;
+  case CaptureCall::ChangeFilterForget:
+    ISSUE(ENTITY, am_change_filter_forget(h));
+    break;
+  case CaptureCall::ChangeFilterClear:
+    ISSUE_GLOBAL(am_change_filter_clear());
+    break;
+
+  case CaptureCall::VelocityTrackingSetConfig: {
+    const auto config = ARG(am_velocity_tracking_config);
+    ISSUE_GLOBAL(am_velocity_tracking_set_config(&config));
+    break;
+  }
+  case CaptureCall::VelocityTrackingGetConfig: {
+    am_velocity_tracking_config config;
+    ISSUE_GLOBAL(am_velocity_tracking_get_config(&config));
+    break;
+  }
+
+  case CaptureCall::RaycastServiceSetConfig: {
+    am_raycast_service_config config = {replay_raycast, nullptr, 0, 0.0f};
+    config.max_rays_per_update = ARG(am_uint32);
+    config.smoothing_time = ARG(am_float32);
+    ISSUE_GLOBAL(am_raycast_service_set_config(&config));
+    break;
+  }
+  case CaptureCall::RaycastServiceRegisterEntity: {
+    auto handle = ENTITY;
+    const auto loudness = ARG(am_float32);
+    ISSUE(handle, am_raycast_service_register_entity(h, loudness));
+    break;
+  }
+  case CaptureCall::RaycastServiceUnregisterEntity:
+    ISSUE(ENTITY, am_raycast_service_unregister_entity(h));
+    break;
+  case CaptureCall::RaycastServiceUpdate: {
+    auto handle = LISTENER;
+    const auto delta_time = ARG(am_time);
+    ISSUE(handle, am_raycast_service_update(h, delta_time));
+    break;
+  }
+  case CaptureCall::RaycastServiceGetEntityCount:
+    ISSUE_GLOBAL(am_raycast_service_get_entity_count());
+    break;
+
+  case CaptureCall::EnvironmentBlendSetConfig: {
+    const auto config = ARG(am_environment_blend_config);
+    ISSUE_GLOBAL(am_environment_blend_set_config(&config));
+    break;
+  }
+  case CaptureCall::EnvironmentBlendGetConfig: {
+    am_environment_blend_config config;
+    ISSUE_GLOBAL(am_environment_blend_get_config(&config));
+    break;
+  }
+  case CaptureCall::EnvironmentBlendRegister:
+    ISSUE(ENVIRONMENT, am_environment_blend_register(h));
+    break;
+  case CaptureCall::EnvironmentBlendUnregister:
+    ISSUE(ENVIRONMENT, am_environment_blend_unregister(h));
+    break;
+  case CaptureCall::EnvironmentBlendUpdate:
+    ISSUE_GLOBAL(am_environment_blend_update());
+    break;
+  case CaptureCall::EnvironmentBlendGetEnvironmentCount:
+    ISSUE_GLOBAL(am_environment_blend_get_environment_count());
+    break;
+
+  default:
+    // The arguments size is unknown, the rest of the capture can't be read
+    std::fprintf(stderr, "Unknown call %u\n", static_cast<unsigned>(call));
+    reader.Fail();
+    return false;
+  }
+
+#undef ENTITY
+#undef LISTENER
+#undef CHANNEL
+#undef BUS
+#undef ENVIRONMENT
+#undef ROOM
+#undef ARG
+#undef ISSUE
+#undef ISSUE_GLOBAL
+
+  return true;
+}
+
+static bool run(std::vector<AmUInt8> data, Replay &replay) {
+  CaptureReader reader(std::move(data));
+
+  AmUInt8 magic[4];
+  for (auto &byte : magic)
+    byte = reader.Read<AmUInt8>();
+
+  const auto version = reader.Read<AmUInt32>();
+  if (std::memcmp(magic, kCaptureMagic, sizeof(magic)) != 0 || version == 0 ||
+      version > kCaptureVersion) {
+    std::fprintf(stderr, "Not a supported capture file\n");
+    return false;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  while (!reader.AtEnd()) {
+    // Version 1 wrote calls as a single byte
+    const AmUInt64 tag =
+        version == 1 ? reader.Read<AmUInt8>() : reader.ReadVarint();
+
+    if (tag == kCaptureHandleTag) {
+      const auto kind = static_cast<CaptureHandleKind>(reader.Read<AmUInt8>());
+      const AmUInt64 index = reader.ReadVarint();
+      const auto id = reader.Read<AmUInt64>();
+      if (static_cast<size_t>(kind) < kCaptureHandleKindCount)
+        define_handle(replay, kind, index, id);
+      continue;
+    }
+
+    if (tag >= kCaptureCallCount) {
+      std::fprintf(stderr, "Unknown call %llu\n",
+                   static_cast<unsigned long long>(tag));
+      reader.Fail();
+      break;
+    }
+
+    replay.recorded_ns += reader.ReadVarint();
+
+    if (replay.realtime) {
+      std::this_thread::sleep_until(
+          start + std::chrono::nanoseconds(replay.recorded_ns));
+    }
+
+    if (replay_call(reader, replay, static_cast<CaptureCall>(tag)))
+      ++replay.calls;
+    else
+      ++replay.skipped;
+
+    ++replay.per_call[tag];
+  }
+
+  if (reader.Failed()) {
+    std::fprintf(stderr, "The capture is truncated\n");
+    return false;
+  }
+
+  return true;
+}
+
+static std::vector<AmUInt8> read_file(const char *path) {
+  std::vector<AmUInt8> data;
+
+  FILE *file = std::fopen(path, "rb");
+  if (!file)
+    return data;
+
+  AmUInt8 block[1 << 16];
+  size_t read = 0;
+  while ((read = std::fread(block, 1, sizeof(block), file)) > 0)
+    data.insert(data.end(), block, block + read);
+
+  std::fclose(file);
+  return data;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr,
+                 "Usage: %s <capture> [--engine-config <path>] "
+                 "[--assets <directory>] [--realtime 0|1] [--repeat <count>]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  const char *config = nullptr;
+  const char *assets = nullptr;
+  bool realtime = false;
+  int repeat = 1;
+
+  for (int i = 2; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    if (key == "--engine-config")
+      config = argv[i + 1];
+    else if (key == "--assets")
+      assets = argv[i + 1];
+    else if (key == "--realtime")
+      realtime = std::atoi(argv[i + 1]) != 0;
+    else if (key == "--repeat")
+      repeat = std::max(std::atoi(argv[i + 1]), 1);
+  }
+
+  const std::vector<AmUInt8> data = read_file(argv[1]);
+  if (data.empty()) {
+    std::fprintf(stderr, "Unable to read %s\n", argv[1]);
+    return 1;
+  }
+
+  bench::initialize_memory();
+  am_boot();
+
+  DiskFileSystem filesystem;
+  const bool live = config && bench::start_engine(filesystem, config, assets);
+  if (config && !live) {
+    std::fprintf(stderr, "The engine failed to initialize\n");
+    return 1;
+  }
+
+  bool succeeded = true;
+  for (int i = 0; i < repeat && succeeded; ++i) {
+    Replay replay;
+    replay.live = live;
+    replay.realtime = realtime;
+
+    const auto start = std::chrono::steady_clock::now();
+    succeeded = run(data, replay);
+    const double elapsed = bench::seconds_since(start);
+
+    std::printf("pass %d: %llu calls replayed, %llu skipped, %.3f s "
+                "(%.3f s recorded), %.0f calls/s\n",
+                i + 1, static_cast<unsigned long long>(replay.calls),
+                static_cast<unsigned long long>(replay.skipped), elapsed,
+                replay.recorded_ns * 1e-9,
+                (replay.calls + replay.skipped) / std::max(elapsed, 1e-9));
+
+    if (i == 0) {
+      for (size_t call = 1; call < kCaptureCallCount; ++call) {
+        if (replay.per_call[call] > 0)
+          std::printf("  call %3zu: %llu\n", call,
+                      static_cast<unsigned long long>(replay.per_call[call]));
+      }
+    }
+  }
+
+  if (live)
+    bench::stop_engine();
+
+  am_shutdown();
+  return succeeded ? 0 : 1;
+}
@@ -19,15 +19,23 @@
 
 #include "amplitude_boot.h"
 #include "amplitude_bus.h"
+#include "amplitude_capture.h"
+#include "amplitude_change_filter.h"
 #include "amplitude_channel.h"
 #include "amplitude_codec.h"
 #include "amplitude_entity.h"
 #include "amplitude_environment.h"
+#include "amplitude_environment_blend.h"
 #include "amplitude_file.h"
 #include "amplitude_filesystem.h"
+#include "amplitude_frame.h"
 #include "amplitude_listener.h"
 #include "amplitude_memory.h"
+#include "amplitude_raycast.h"
 #include "amplitude_room.h"
+#include "amplitude_stats.h"
 #include "amplitude_thread.h"
+#include "amplitude_trace.h"
+#include "amplitude_velocity.h"
 
 #endif // _AM_C_H
@@ -0,0 +1,81 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_CAPTURE_H
+#define _AM_C_CAPTURE_H
+
+#include "amplitude_common.h"
+#include "amplitude_file.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts recording the C API calls into the given file.
+ *
+ * Every entity, listener, channel, bus, environment and room call made by the application is
+ * recorded with its arguments and a timestamp, in a compact binary log, along with the frame
+ * snapshot, change filter, velocity tracking, raycast service and environment blend calls. Handles
+ * are replaced by small indices, and the engine identifier of each handle is recorded the first
+ * time it is used, so the session can be replayed later against another engine instance with the
+ * @c amplitude_c_replay tool.
+ *
+ * The following calls are not recorded:
+ * - Codec, file, filesystem, thread and memory calls, which carry user callbacks and raw memory.
+ * - Boot, capture, stats and trace calls, which set up the process or observe it.
+ * - am_channel_on_event() and am_entity_for_each(), which take user callbacks.
+ * - am_entity_get_all(), am_entity_compute_audibility(), am_listener_transform_points() and
+ *   am_listener_get_spherical_positions(), which only read state into caller arrays.
+ *
+ * The raycast callback is not recorded either, only the ray budget and smoothing time of
+ * am_raycast_service_set_config(). Zones and box shapes given to environments and rooms are
+ * created by the application, so only the call itself is recorded.
+ *
+ * Records are buffered in memory and written to the file in large blocks.
+ *
+ * @param[in] file The file to write the log to. Must be opened for writing, and stay valid until
+ * @c am_capture_stop() is called.
+ *
+ * @return AM_TRUE if the capture started, AM_FALSE if a capture is already running or the file is
+ * not valid.
+ */
+__api am_bool
+am_capture_start(am_file_handle file);
+
+/**
+ * @brief Stops the current capture and writes the remaining records to its file.
+ *
+ * @return AM_TRUE if every record was written, AM_FALSE if no capture was running or a write failed.
+ */
+__api am_bool
+am_capture_stop(void);
+
+/**
+ * @brief Checks whether a capture is running.
+ */
+__api am_bool
+am_capture_is_active(void);
+
+/**
+ * @brief Gets the number of calls recorded by the current or the last capture.
+ */
+__api am_uint64
+am_capture_get_call_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_CAPTURE_H
@@ -0,0 +1,131 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_CHANGE_FILTER_H
+#define _AM_C_CHANGE_FILTER_H
+
+#include "amplitude_common.h"
+#include "amplitude_entity.h"
+
+/**
+ * @brief The entity fields filtered by the change filter.
+ */
+typedef enum am_change_filter_field : am_uint8
+{
+    am_change_filter_field_location = 0,
+    am_change_filter_field_orientation = 1,
+    am_change_filter_field_obstruction = 2,
+    am_change_filter_field_occlusion = 3,
+    am_change_filter_field_directivity = 4,
+    am_change_filter_field_max
+} am_change_filter_field;
+
+/**
+ * @brief Tolerances under which a new value is considered unchanged.
+ */
+typedef struct
+{
+    am_float32 location_epsilon; /**< Largest difference on any axis of a location */
+    am_float32 orientation_epsilon; /**< Largest value of 1 - |dot(q1, q2)| between two orientations */
+    am_float32 scalar_epsilon; /**< Largest difference of obstruction, occlusion, directivity and sharpness */
+} am_change_filter_config;
+
+/**
+ * @brief Number of values submitted to and dropped by the change filter, per field.
+ */
+typedef struct
+{
+    am_uint64 submitted[am_change_filter_field_max];
+    am_uint64 skipped[am_change_filter_field_max];
+} am_change_filter_stats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enables or disables the change filter.
+ *
+ * When enabled, am_entity_set_location(), am_entity_set_orientation(), am_entity_set_obstruction(),
+ * am_entity_set_occlusion() and am_entity_set_directivity() compare the new value with the last one
+ * they sent to the engine for the same entity, and drop it if it is within the configured
+ * tolerance. Unchanged values then cost a lookup instead of an engine state write.
+ *
+ * The filter only knows the values sent through these functions. Call am_change_filter_forget()
+ * when an entity is removed, or when its state is changed by other means.
+ *
+ * The filter is disabled by default. Disabling it clears the cached values.
+ *
+ * @param[in] enabled Whether to filter unchanged values.
+ */
+__api void
+am_change_filter_set_enabled(am_bool enabled);
+
+/**
+ * @brief Checks whether the change filter is enabled.
+ */
+__api am_bool
+am_change_filter_is_enabled(void);
+
+/**
+ * @brief Sets the tolerances of the change filter.
+ *
+ * Defaults to 1e-4 for locations, 1e-6 for orientations and 1e-4 for scalars.
+ *
+ * @param[in] config The new tolerances.
+ */
+__api void
+am_change_filter_set_config(const am_change_filter_config* config);
+
+/**
+ * @brief Gets the tolerances of the change filter.
+ *
+ * @param[out] config Receives the current tolerances.
+ */
+__api void
+am_change_filter_get_config(am_change_filter_config* config);
+
+/**
+ * @brief Gets the number of submitted and dropped values since the last reset.
+ *
+ * @param[out] stats Receives the counters.
+ */
+__api void
+am_change_filter_get_stats(am_change_filter_stats* stats);
+
+/**
+ * @brief Resets the counters of the change filter.
+ */
+__api void
+am_change_filter_reset_stats(void);
+
+/**
+ * @brief Forgets the values sent for an entity, so its next values are always sent.
+ *
+ * @param[in] entity The entity to forget.
+ */
+__api void
+am_change_filter_forget(am_entity_handle entity);
+
+/**
+ * @brief Forgets the values sent for every entity.
+ */
+__api void
+am_change_filter_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_CHANGE_FILTER_H
@@ -17,6 +17,7 @@
 
 #include "amplitude_common.h"
 #include "amplitude_file.h"
+#include "amplitude_thread.h"
 
 /**
  * @file amplitude_codec.h
@@ -37,6 +38,18 @@ typedef enum
     am_audio_sample_format_unknown /**< Unknown or unsupported format */
 } am_audio_sample_format;
 
+/**
+ * @brief PCM sample types supported by the sample conversion functions.
+ */
+typedef enum
+{
+    am_pcm_sample_type_int16, /**< 16-bit signed integer sample */
+    am_pcm_sample_type_int24, /**< 24-bit signed integer sample, packed in 3 little-endian bytes */
+    am_pcm_sample_type_int32, /**< 32-bit signed integer sample */
+    am_pcm_sample_type_float32, /**< 32-bit floating-point sample, in the range [-1, 1] */
+    am_pcm_sample_type_unknown /**< Unknown or unsupported sample type */
+} am_pcm_sample_type;
+
 /**
  * @brief Audio format structure containing sample format information.
  */
@@ -72,12 +85,44 @@ struct am_codec_encoder;
 typedef struct am_codec_encoder am_codec_encoder;
 typedef am_codec_encoder* am_codec_encoder_handle;
 
+/**
+ * @brief Opaque handle to a decoding stream instance.
+ *
+ * A decoding stream owns a ring buffer that is filled ahead of time by a decoder,
+ * and from which frames can be pulled without waiting for the decoder.
+ */
+struct am_codec_stream;
+typedef struct am_codec_stream am_codec_stream;
+typedef am_codec_stream* am_codec_stream_handle;
+
+/**
+ * @brief Opaque handle to an encoding stream instance.
+ *
+ * An encoding stream buffers frames in a ring buffer, from which they are encoded
+ * in the background without blocking the thread writing them.
+ */
+struct am_codec_encoder_stream;
+typedef struct am_codec_encoder_stream am_codec_encoder_stream;
+typedef am_codec_encoder_stream* am_codec_encoder_stream_handle;
+
+/**
+ * @brief Opaque handle to a sample rate converter.
+ *
+ * A sample rate converter wraps a decoder and delivers its frames at another sample rate.
+ */
+struct am_codec_resampler;
+typedef struct am_codec_resampler am_codec_resampler;
+typedef am_codec_resampler* am_codec_resampler_handle;
+
 /**
  * @brief Virtual function table for codec decoder operations.
  *
  * This structure contains function pointers that implement the decoder
  * functionality. All functions receive user_data as their first parameter for
  * context.
+ *
+ * Optional decoder functions added after this structure was published live in
+ * am_codec_decoder_ext_vtable, so the layout of this one never changes.
  */
 typedef struct
 {
@@ -143,6 +188,65 @@ typedef struct
     am_bool (*seek)(am_voidptr user_data, am_uint64 offset);
 } am_codec_decoder_vtable;
 
+/**
+ * @brief Optional decoder functions, extending am_codec_decoder_vtable.
+ *
+ * Initialize it with am_codec_decoder_ext_vtable_init() before setting the functions, so
+ * that @c struct_size is set and unused functions are NULL.
+ */
+typedef struct
+{
+    /**
+     * @brief The size of this structure, set by am_codec_decoder_ext_vtable_init().
+     *
+     * Functions appended to this structure in later versions are only read when this size
+     * covers them.
+     */
+    am_size struct_size;
+
+    /**
+     * @brief Reset the decoder instance so it can be reused (optional).
+     *
+     * When provided, destroyed decoders are kept in a per-codec pool instead of
+     * being released, and are handed back by the next decoder creation. This function
+     * must close any opened file and bring the decoder back to its freshly created
+     * state, while it may keep its internal buffers around.
+     *
+     * @param user_data User-provided context data.
+     * @return AM_TRUE if the decoder can be reused, AM_FALSE to release it.
+     */
+    am_bool (*reset)(am_voidptr user_data);
+
+    /**
+     * @brief Resume decoding at a frame, starting from a recorded checkpoint (optional).
+     *
+     * When provided, the bindings keep a seek table of (frame, byte offset) checkpoints
+     * for each opened file. Seeks, and streams which do not continue where the previous
+     * call stopped, first call this function with the nearest checkpoint before the target,
+     * so the decoder only has to scan from there.
+     *
+     * @param user_data User-provided context data.
+     * @param frame The frame to resume decoding at.
+     * @param checkpoint_frame The frame of the checkpoint, at or before @c frame.
+     * @param checkpoint_offset The byte offset in the file of the checkpoint.
+     * @return AM_TRUE if the decoder is now at @c frame, AM_FALSE to fall back to a regular seek.
+     */
+    am_bool (*seek_to_checkpoint)(am_voidptr user_data, am_uint64 frame, am_uint64 checkpoint_frame, am_uint64 checkpoint_offset);
+
+    /**
+     * @brief Get the last position the decoder can resume from (optional).
+     *
+     * Called after each stream call to record checkpoints. When not provided, the
+     * checkpoint is the frame following the last decoded one, with the current file position.
+     *
+     * @param user_data User-provided context data.
+     * @param frame Pointer to store the frame of the checkpoint.
+     * @param offset Pointer to store the byte offset in the file of the checkpoint.
+     * @return AM_TRUE if a checkpoint is available, AM_FALSE otherwise.
+     */
+    am_bool (*get_checkpoint)(am_voidptr user_data, am_uint64* frame, am_uint64* offset);
+} am_codec_decoder_ext_vtable;
+
 /**
  * @brief Virtual function table for codec encoder operations.
  *
@@ -254,12 +358,170 @@ typedef struct
         am_codec_encoder_vtable* v_table; /**< Virtual function table for encoder operations */
         am_voidptr user_data; /**< User-provided context data for encoder */
     } encoder;
+
+    am_codec_decoder_ext_vtable* decoder_ext_v_table; /**< Optional decoder functions, NULL when unused */
 } am_codec_config;
 
+/**
+ * @brief Configuration structure for decoding streams.
+ */
+typedef struct
+{
+    /**
+     * @brief The capacity of the ring buffer, in frames.
+     */
+    am_uint64 capacity;
+
+    /**
+     * @brief The number of buffered frames under which a refill is requested.
+     */
+    am_uint64 low_watermark;
+
+    /**
+     * @brief The maximum number of frames decoded by a single decoder call.
+     */
+    am_uint64 chunk_size;
+
+    /**
+     * @brief Whether the stream should restart from the beginning when the decoder reaches the end of the file.
+     */
+    am_bool loop;
+
+    /**
+     * @brief The thread pool on which refills are scheduled.
+     *
+     * When NULL, refills only happen when calling am_codec_stream_refill().
+     */
+    am_thread_pool_handle pool;
+} am_codec_stream_config;
+
+/**
+ * @brief Configuration structure for encoding streams.
+ */
+typedef struct
+{
+    /**
+     * @brief The capacity of the ring buffer, in frames.
+     */
+    am_uint64 capacity;
+
+    /**
+     * @brief The number of buffered frames from which the encoder is called, and the
+     * maximum number of frames given to a single encoder call.
+     */
+    am_uint64 chunk_size;
+
+    /**
+     * @brief The thread pool on which the encoder is called.
+     *
+     * When NULL, frames are only encoded when calling am_codec_encoder_stream_drain()
+     * or am_codec_encoder_stream_flush(), so the writing thread never calls the encoder.
+     */
+    am_thread_pool_handle pool;
+} am_codec_encoder_stream_config;
+
+/**
+ * @brief State of an encoding stream.
+ */
+typedef struct
+{
+    am_uint64 free; /**< Number of frames that can be written without being rejected */
+    am_uint64 pending; /**< Number of frames waiting to be encoded */
+    am_uint64 encoded; /**< Total number of frames encoded */
+    am_uint64 rejected; /**< Total number of frames rejected because the ring buffer was full */
+    am_bool failed; /**< Whether the last encoder call refused frames, which stay buffered until the next drain */
+} am_codec_encoder_stream_stats;
+
+/**
+ * @brief Interpolation methods of the sample rate converter.
+ */
+typedef enum
+{
+    /**
+     * @brief Linear interpolation between the two nearest frames.
+     *
+     * Very cheap, but lets aliasing through and dulls high frequencies.
+     */
+    am_resampler_quality_linear = 0,
+
+    /**
+     * @brief Polyphase windowed-sinc filter.
+     *
+     * Band-limited interpolation, suitable for music and long ambiences.
+     */
+    am_resampler_quality_sinc = 1
+} am_resampler_quality;
+
+/**
+ * @brief Configuration structure for sample rate converters.
+ */
+typedef struct
+{
+    /**
+     * @brief The sample rate of the converted frames.
+     */
+    am_uint32 sample_rate;
+
+    /**
+     * @brief The interpolation method.
+     */
+    am_resampler_quality quality;
+
+    /**
+     * @brief The number of source frames weighted for each output frame, in sinc mode.
+     *
+     * Rounded up to a multiple of 8. Longer filters have a sharper cutoff and cost more.
+     */
+    am_uint32 filter_length;
+
+    /**
+     * @brief The number of precomputed filter phases, in sinc mode.
+     *
+     * Coefficients between two phases are linearly interpolated.
+     */
+    am_uint32 filter_phases;
+
+    /**
+     * @brief The maximum number of source frames decoded by a single decoder call.
+     */
+    am_uint64 chunk_size;
+} am_codec_resampler_config;
+
+/**
+ * @brief Usage counters of the decoded sounds cache.
+ */
+typedef struct
+{
+    am_uint64 hits; /**< Number of loads served from the cache */
+    am_uint64 misses; /**< Number of loads which had to decode the file */
+    am_uint64 evictions; /**< Number of entries released to make room for new ones */
+    am_size used_bytes; /**< Number of bytes currently held by the cache */
+    am_size capacity; /**< Maximum number of bytes the cache can hold */
+    am_size entries; /**< Number of sounds currently held by the cache */
+} am_codec_cache_stats;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Initialize a decoder virtual table with all functions set to NULL.
+ *
+ * Optional functions left unset must stay NULL.
+ *
+ * @return Initialized decoder virtual table.
+ */
+__api am_codec_decoder_vtable
+am_codec_decoder_vtable_init(void);
+
+/**
+ * @brief Initialize a decoder extension table with all functions set to NULL.
+ *
+ * @return Initialized decoder extension table, with @c struct_size set.
+ */
+__api am_codec_decoder_ext_vtable
+am_codec_decoder_ext_vtable_init(void);
+
 /**
  * @brief Initialize a codec configuration structure with default values.
  *
@@ -287,6 +549,24 @@ am_codec_config_init(const char* name);
 __api void
 am_codec_register(const am_codec_config* config);
 
+/**
+ * @brief Register the built-in PCM codec, named "pcm".
+ *
+ * The codec decodes uncompressed WAV files holding 16, 24 or 32-bit integer, or 32-bit
+ * float samples. It is implemented in the bindings, so decoding does not go through any
+ * C callback: frames are read straight into the output buffer, and memory files are
+ * accessible without copy through am_codec_decoder_map(). The codec has no encoder.
+ *
+ * The codec only claims WAV files in one of these sample formats, so WAV files with
+ * compressed samples still reach the other registered codecs.
+ *
+ * Calling this function again returns the already registered codec.
+ *
+ * @return Handle to the codec.
+ */
+__api am_codec_handle
+am_codec_register_pcm(void);
+
 /**
  * @brief Unregister a codec from the Amplitude Audio engine.
  *
@@ -312,8 +592,13 @@ am_codec_find(const char* name);
 /**
  * @brief Find a codec that can handle the specified file.
  *
- * This function searches through all registered codecs to find one
- * that can handle the given file.
+ * The result is cached by file path, so probing the same file again is a
+ * single lookup. The cache keeps the most recently probed paths, up to the capacity
+ * set with am_codec_probe_cache_set_capacity(), and is cleared when a codec or a
+ * signature is registered or removed. On a cache miss, the first bytes of the file are read once
+ * and matched against the signatures registered with am_codec_register_signature().
+ * Only when no signature matches, this function searches through all registered
+ * codecs to find one that can handle the given file.
  *
  * @param file File handle to check.
  * @return Handle to a suitable codec if found, NULL otherwise.
@@ -321,6 +606,50 @@ am_codec_find(const char* name);
 __api am_codec_handle
 am_codec_find_for_file(am_file_handle file);
 
+/**
+ * @brief Register a magic number identifying files handled by a codec.
+ *
+ * Signatures let am_codec_find_for_file() detect the codec of a file with one header
+ * read, without calling the @c on_can_handle_file function of every registered codec.
+ * When several signatures match, the longest one wins.
+ *
+ * @param codec_name The name of the codec handling the files.
+ * @param magic The bytes to match.
+ * @param length The number of bytes to match.
+ * @param offset The position of the bytes from the start of the file.
+ * @return AM_TRUE if the signature was registered, AM_FALSE if the parameters are invalid
+ * or the signature ends after the first 64 bytes of the file.
+ */
+__api am_bool
+am_codec_register_signature(const char* codec_name, const am_uint8* magic, am_size length, am_size offset);
+
+/**
+ * @brief Remove all the signatures registered for a codec.
+ *
+ * @param codec_name The name of the codec.
+ */
+__api void
+am_codec_unregister_signatures(const char* codec_name);
+
+/**
+ * @brief Forget all the codecs previously found for file paths.
+ *
+ * Call this function when files may have been replaced on disk.
+ */
+__api void
+am_codec_probe_cache_clear(void);
+
+/**
+ * @brief Set the maximum number of file paths kept in the probe cache.
+ *
+ * When more paths than this were probed, the least recently probed ones are
+ * forgotten. Defaults to 1024 paths.
+ *
+ * @param[in] count The maximum number of cached paths.
+ */
+__api void
+am_codec_probe_cache_set_capacity(am_size count);
+
 /**
  * @brief Check if a codec can handle the specified file.
  *
@@ -331,6 +660,28 @@ am_codec_find_for_file(am_file_handle file);
 __api am_bool
 am_codec_can_handle_file(am_codec_handle codec, am_file_handle file);
 
+/**
+ * @brief Set the maximum number of idle decoders kept in the pool of a codec.
+ *
+ * Decoders are only pooled when the codec's decoder extension table provides
+ * a @c reset function. The default pool size is 16. Shrinking the pool
+ * releases the extra idle decoders immediately.
+ *
+ * @param codec Handle to the codec.
+ * @param size The maximum number of idle decoders to keep. Use 0 to disable pooling.
+ */
+__api void
+am_codec_set_decoder_pool_size(am_codec_handle codec, am_uint32 size);
+
+/**
+ * @brief Get the number of idle decoders currently kept in the pool of a codec.
+ *
+ * @param codec Handle to the codec.
+ * @return The number of idle decoders ready to be reused.
+ */
+__api am_uint32
+am_codec_get_decoder_pool_count(am_codec_handle codec);
+
 /**
  * @brief Get the name of a codec.
  *
@@ -365,6 +716,9 @@ am_codec_decoder_create_from_codec(am_codec_handle codec);
 /**
  * @brief Destroy a decoder instance.
  *
+ * When the codec pools its decoders, the instance is reset and kept for reuse
+ * instead of being released.
+ *
  * @param handle Handle to the decoder to destroy.
  */
 __api void
@@ -429,6 +783,58 @@ am_codec_decoder_load(am_codec_decoder_handle handle, am_voidptr out);
 __api am_uint64
 am_codec_decoder_stream(am_codec_decoder_handle handle, am_voidptr out, am_uint64 buffer_offset, am_uint64 seek_offset, am_uint64 length);
 
+/**
+ * @brief Stream a portion of the files opened by several decoders at once.
+ *
+ * This is equivalent to calling am_codec_decoder_stream() for each decoder, but all the
+ * handles are resolved with a single access to the handle registry. When a thread pool
+ * is given, the decoders are split in ranges streamed in parallel by the pool and the
+ * calling thread, and this function returns when all of them are done.
+ *
+ * @note A decoder cannot be streamed by two threads at once. When a decoder appears more
+ * than once in @c handles, all the decoders are streamed in order on the calling thread.
+ *
+ * @param[in] handles Handles to the decoders.
+ * @param[in] outs Pointers to the output buffers, one per decoder.
+ * @param[in] buffer_offsets Offsets in frames within each output buffer, or NULL for no offsets.
+ * @param[in] seek_offsets Offsets in frames within each source file.
+ * @param[in] lengths Numbers of frames to read for each decoder.
+ * @param[out] results Numbers of frames actually read by each decoder, 0 for invalid handles.
+ * @param[in] count The number of decoders.
+ * @param[in] pool The thread pool to fan out on, or NULL to stream on the calling thread.
+ */
+__api void
+am_codec_decoder_stream_many(
+    const am_codec_decoder_handle* handles,
+    const am_voidptr* outs,
+    const am_uint64* buffer_offsets,
+    const am_uint64* seek_offsets,
+    const am_uint64* lengths,
+    am_uint64* results,
+    am_size count,
+    am_thread_pool_handle pool);
+
+/**
+ * @brief Set the sample format written by am_codec_decoder_load() and am_codec_decoder_stream().
+ *
+ * When the format reported by the decoder's @c get_format function differs from the
+ * requested one, decoded frames are converted automatically using the vectorized
+ * sample conversion functions. 24-bit and 32-bit integer decoders are recognized from
+ * the @c bits_per_sample field of their format.
+ *
+ * After this call, am_codec_decoder_get_format() reports the converted format.
+ *
+ * @note Only decoders of codecs registered through am_codec_register() can convert
+ * their output. For decoders of the engine's own codecs, this function returns AM_FALSE.
+ *
+ * @param handle Handle to the decoder.
+ * @param format The sample format to output, or am_audio_sample_format_unknown
+ * to output the decoder's own format.
+ * @return AM_TRUE if successful, AM_FALSE if the decoder format cannot be converted.
+ */
+__api am_bool
+am_codec_decoder_set_output_format(am_codec_decoder_handle handle, am_audio_sample_format format);
+
 /**
  * @brief Seek to a specific position in the audio file.
  *
@@ -439,6 +845,352 @@ am_codec_decoder_stream(am_codec_decoder_handle handle, am_voidptr out, am_uint6
 __api am_bool
 am_codec_decoder_seek(am_codec_decoder_handle handle, am_uint64 offset);
 
+// Seek table functions
+
+/**
+ * @brief Write the seek table recorded for the file opened by a decoder.
+ *
+ * Use this to store a sidecar file next to long tracks, and reload it with
+ * am_codec_decoder_load_seek_table() so that seeks are fast from the first playback.
+ *
+ * @param[in] handle Handle to the decoder, with a file opened.
+ * @param[in] file The file to write the seek table to.
+ *
+ * @return AM_TRUE if successful, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_decoder_save_seek_table(am_codec_decoder_handle handle, am_file_handle file);
+
+/**
+ * @brief Merge a seek table written by am_codec_decoder_save_seek_table() into the one of a decoder.
+ *
+ * @param[in] handle Handle to the decoder, with a file opened.
+ * @param[in] file The file to read the seek table from.
+ *
+ * @return AM_TRUE if successful, AM_FALSE if the file is not a valid seek table.
+ */
+__api am_bool
+am_codec_decoder_load_seek_table(am_codec_decoder_handle handle, am_file_handle file);
+
+/**
+ * @brief Get the number of checkpoints in the seek table of the file opened by a decoder.
+ *
+ * @param[in] handle Handle to the decoder.
+ *
+ * @return The number of checkpoints.
+ */
+__api am_uint64
+am_codec_decoder_get_seek_table_size(am_codec_decoder_handle handle);
+
+/**
+ * @brief Set the minimum number of frames between two recorded checkpoints.
+ *
+ * Defaults to 16384 frames.
+ *
+ * @param[in] frames The minimum checkpoint spacing, in frames.
+ */
+__api void
+am_codec_seek_table_set_interval(am_uint64 frames);
+
+/**
+ * @brief Release the seek tables of all the files which are not opened by a decoder.
+ *
+ * Seek tables are shared by all the decoders of the same file and codec, and are kept
+ * after the decoders are closed so that the next ones can seek quickly.
+ */
+__api void
+am_codec_seek_tables_clear(void);
+
+/**
+ * @brief Set the maximum number of seek tables kept.
+ *
+ * When more files than this have a seek table, the least recently opened ones which
+ * are not opened by a decoder are released. Tables of opened files are never released.
+ * Defaults to 256 tables.
+ *
+ * @param[in] count The maximum number of seek tables.
+ */
+__api void
+am_codec_seek_tables_set_capacity(am_size count);
+
+// Stream functions
+
+/**
+ * @brief Initialize a decoding stream configuration structure with default values.
+ *
+ * The default configuration buffers 16384 frames, requests a refill when less than
+ * half of them are available, decodes at most 4096 frames per decoder call, does not
+ * loop and has no thread pool attached.
+ *
+ * @return Initialized decoding stream configuration structure.
+ */
+__api am_codec_stream_config
+am_codec_stream_config_init(void);
+
+/**
+ * @brief Create a decoding stream reading from an opened decoder.
+ *
+ * The decoder must already have a file opened, and must stay alive while the stream
+ * is in use. The stream keeps a reference to it, so destroying the decoder handle
+ * before the stream is safe. The ring buffer is filled synchronously once before this
+ * function returns, so that the first reads never starve.
+ *
+ * @param[in] decoder Handle to the decoder to read frames from.
+ * @param[in] config Pointer to the stream configuration structure.
+ *
+ * @return Handle to the stream if successful, NULL otherwise.
+ */
+__api am_codec_stream_handle
+am_codec_stream_create(am_codec_decoder_handle decoder, const am_codec_stream_config* config);
+
+/**
+ * @brief Destroy a decoding stream.
+ *
+ * A refill already running on the thread pool completes before the stream memory is released.
+ *
+ * @param[in] stream Handle to the stream to destroy.
+ */
+__api void
+am_codec_stream_destroy(am_codec_stream_handle stream);
+
+/**
+ * @brief Pull decoded frames out of the stream.
+ *
+ * This function never waits for the decoder. It copies at most @c frames frames from the
+ * ring buffer, and schedules a refill on the stream's thread pool when the number of
+ * buffered frames falls under the low watermark.
+ *
+ * @note Only one thread may read from a stream at a time.
+ *
+ * @param[in] stream Handle to the stream.
+ * @param[out] dst Pointer to the destination buffer, large enough to hold @c frames frames.
+ * @param[in] frames The maximum number of frames to read.
+ *
+ * @return The number of frames actually copied to the destination buffer.
+ */
+__api am_uint64
+am_codec_stream_read(am_codec_stream_handle stream, am_voidptr dst, am_uint64 frames);
+
+/**
+ * @brief Decode frames into the stream until its ring buffer is full or the file ends.
+ *
+ * Use this function to drive refills manually when the stream has no thread pool.
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return The number of frames decoded.
+ */
+__api am_uint64
+am_codec_stream_refill(am_codec_stream_handle stream);
+
+/**
+ * @brief Move the stream to the given frame in the source file.
+ *
+ * All buffered frames are discarded, and decoding resumes from the given frame.
+ *
+ * @note This function may be called from any thread. It waits for any in-flight
+ * am_codec_stream_read() and refill to complete before resetting the buffer.
+ *
+ * @param[in] stream Handle to the stream.
+ * @param[in] frame The frame in the source file to resume decoding from.
+ *
+ * @return AM_TRUE if successful, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_stream_seek(am_codec_stream_handle stream, am_uint64 frame);
+
+/**
+ * @brief Get the number of decoded frames ready to be read from the stream.
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return The number of buffered frames.
+ */
+__api am_uint64
+am_codec_stream_get_available(am_codec_stream_handle stream);
+
+/**
+ * @brief Get the position in the source file of the next frame returned by am_codec_stream_read().
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return The frame position in the source file.
+ */
+__api am_uint64
+am_codec_stream_get_position(am_codec_stream_handle stream);
+
+/**
+ * @brief Check whether the decoder reached the end of the file and all frames were read.
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return AM_TRUE if the stream has no more frames to provide, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_stream_is_finished(am_codec_stream_handle stream);
+
+// Encoder stream functions
+
+/**
+ * @brief Initialize an encoding stream configuration structure with default values.
+ *
+ * The default configuration buffers 16384 frames, encodes them by chunks of 4096 frames,
+ * and has no thread pool attached.
+ *
+ * @return Initialized encoding stream configuration structure.
+ */
+__api am_codec_encoder_stream_config
+am_codec_encoder_stream_config_init(void);
+
+/**
+ * @brief Create an encoding stream writing to an opened encoder.
+ *
+ * The encoder must already have a file opened and its format set. The stream keeps a
+ * reference to it, so destroying the encoder handle before the stream is safe.
+ *
+ * @param[in] encoder Handle to the encoder to write frames to.
+ * @param[in] config Pointer to the stream configuration structure.
+ *
+ * @return Handle to the stream if successful, NULL otherwise.
+ */
+__api am_codec_encoder_stream_handle
+am_codec_encoder_stream_create(am_codec_encoder_handle encoder, const am_codec_encoder_stream_config* config);
+
+/**
+ * @brief Encode all the buffered frames, then destroy the encoding stream.
+ *
+ * The encoder is not closed.
+ *
+ * @param[in] stream Handle to the stream to destroy.
+ */
+__api void
+am_codec_encoder_stream_destroy(am_codec_encoder_stream_handle stream);
+
+/**
+ * @brief Push frames to encode into the stream.
+ *
+ * This function never waits for the encoder. When the ring buffer is full, the frames
+ * which do not fit are rejected and the returned count is lower than @c frames; check
+ * the @c free field of am_codec_encoder_stream_get_stats() to apply backpressure upstream.
+ *
+ * @note Only one thread may write to a stream at a time.
+ *
+ * @param[in] stream Handle to the stream.
+ * @param[in] src Pointer to the frames to encode, in the encoder format.
+ * @param[in] frames The number of frames to encode.
+ *
+ * @return The number of frames accepted.
+ */
+__api am_uint64
+am_codec_encoder_stream_write(am_codec_encoder_stream_handle stream, const void* src, am_uint64 frames);
+
+/**
+ * @brief Encode the buffered frames by whole chunks on the calling thread.
+ *
+ * Call this regularly from a worker thread when the stream has no thread pool. Frames
+ * the encoder refuses stay buffered and are retried by the next drain. Does nothing if
+ * another drain is in progress.
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return The number of frames encoded by this call.
+ */
+__api am_uint64
+am_codec_encoder_stream_drain(am_codec_encoder_stream_handle stream);
+
+/**
+ * @brief Encode all the buffered frames, and wait for the encoder to finish.
+ *
+ * Stops early when the encoder refuses frames, which stay buffered.
+ *
+ * @param[in] stream Handle to the stream.
+ *
+ * @return The number of frames encoded by this call.
+ */
+__api am_uint64
+am_codec_encoder_stream_flush(am_codec_encoder_stream_handle stream);
+
+/**
+ * @brief Get the state of an encoding stream.
+ *
+ * @param[in] stream Handle to the stream.
+ * @param[out] stats Pointer to store the state of the stream.
+ *
+ * @return AM_TRUE if successful, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_encoder_stream_get_stats(am_codec_encoder_stream_handle stream, am_codec_encoder_stream_stats* stats);
+
+// Resampler functions
+
+/**
+ * @brief Initialize a sample rate converter configuration structure with default values.
+ *
+ * The default configuration uses a 32 frames long sinc filter with 256 phases, and
+ * decodes at most 1024 source frames per decoder call.
+ *
+ * @param[in] sample_rate The sample rate of the converted frames.
+ *
+ * @return Initialized sample rate converter configuration structure.
+ */
+__api am_codec_resampler_config
+am_codec_resampler_config_init(am_uint32 sample_rate);
+
+/**
+ * @brief Create a sample rate converter reading from an opened decoder.
+ *
+ * The decoder must already have a file opened. Its frames are converted to 32-bit float
+ * before being resampled, whatever its sample format. The converter keeps a reference to
+ * the decoder, so destroying the decoder handle before the converter is safe.
+ *
+ * @param[in] decoder Handle to the decoder to read frames from.
+ * @param[in] config Pointer to the sample rate converter configuration structure.
+ *
+ * @return Handle to the sample rate converter if successful, NULL otherwise.
+ */
+__api am_codec_resampler_handle
+am_codec_resampler_create(am_codec_decoder_handle decoder, const am_codec_resampler_config* config);
+
+/**
+ * @brief Destroy a sample rate converter.
+ *
+ * @param[in] resampler Handle to the sample rate converter to destroy.
+ */
+__api void
+am_codec_resampler_destroy(am_codec_resampler_handle resampler);
+
+/**
+ * @brief Get the format of the converted frames.
+ *
+ * The format has the target sample rate, the channel count of the decoder, 32-bit
+ * float samples, and the number of frames of the file at the target sample rate.
+ *
+ * @param[in] resampler Handle to the sample rate converter.
+ * @param[out] format Pointer to store the format information.
+ *
+ * @return AM_TRUE if successful, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_resampler_get_format(am_codec_resampler_handle resampler, am_sound_format* format);
+
+/**
+ * @brief Stream converted frames, with the same semantics as am_codec_decoder_stream().
+ *
+ * Consecutive calls continuing where the previous one stopped only decode new source
+ * frames. Any other @c seek_offset restarts the conversion from that position.
+ *
+ * @param[in] resampler Handle to the sample rate converter.
+ * @param[out] out Pointer to the interleaved output buffer.
+ * @param[in] buffer_offset Offset in frames within the output buffer.
+ * @param[in] seek_offset Offset in frames within the converted file, at the target sample rate.
+ * @param[in] length Number of frames to produce.
+ *
+ * @return Number of frames actually written to the buffer.
+ */
+__api am_uint64
+am_codec_resampler_stream(
+    am_codec_resampler_handle resampler, am_float32* out, am_uint64 buffer_offset, am_uint64 seek_offset, am_uint64 length);
+
 // Encoder functions
 
 /**
@@ -510,6 +1262,127 @@ am_codec_encoder_set_format(am_codec_encoder_handle handle, const am_sound_forma
 __api am_uint64
 am_codec_encoder_write(am_codec_encoder_handle handle, am_voidptr in, am_uint64 offset, am_uint64 length);
 
+// Cache functions
+
+/**
+ * @brief Set the maximum number of bytes held by the decoded sounds cache.
+ *
+ * When enabled, am_codec_decoder_load() first looks for the sound in the cache, using
+ * the path of the opened file, the codec name and the decoder output format as the key.
+ * On a miss the decoded frames are copied into the cache, in the sound data memory pool,
+ * evicting the least recently used sounds when needed.
+ *
+ * The cache is disabled by default. Setting a capacity of 0 disables it again, releasing
+ * all the entries which are not pinned.
+ *
+ * @param capacity The maximum number of bytes the cache can hold.
+ */
+__api void
+am_codec_cache_set_capacity(am_size capacity);
+
+/**
+ * @brief Get the maximum number of bytes held by the decoded sounds cache.
+ *
+ * @return The cache capacity in bytes.
+ */
+__api am_size
+am_codec_cache_get_capacity(void);
+
+/**
+ * @brief Prevent the sounds decoded from a file from being evicted from the cache.
+ *
+ * The pin applies to sounds already in the cache as well as sounds loaded later.
+ * Pinned sounds still count towards the cache capacity.
+ *
+ * @param path The path of the file, as returned by am_file_get_path().
+ * @param codec_name The name of the codec used to decode the file.
+ */
+__api void
+am_codec_cache_pin(const am_oschar* path, const char* codec_name);
+
+/**
+ * @brief Allow the sounds decoded from a file to be evicted from the cache again.
+ *
+ * @param path The path of the file, as returned by am_file_get_path().
+ * @param codec_name The name of the codec used to decode the file.
+ */
+__api void
+am_codec_cache_unpin(const am_oschar* path, const char* codec_name);
+
+/**
+ * @brief Release all the sounds held by the cache, except pinned ones.
+ */
+__api void
+am_codec_cache_clear(void);
+
+/**
+ * @brief Get the usage counters of the decoded sounds cache.
+ *
+ * @param stats Pointer to store the counters.
+ * @return AM_TRUE if successful, AM_FALSE otherwise.
+ */
+__api am_bool
+am_codec_cache_get_stats(am_codec_cache_stats* stats);
+
+/**
+ * @brief Reset the hits, misses and evictions counters of the decoded sounds cache.
+ */
+__api void
+am_codec_cache_reset_stats(void);
+
+// Sample conversion functions
+
+/**
+ * @brief Convert PCM samples to 32-bit float samples.
+ *
+ * The conversion uses AVX2, SSE2 or NEON instructions when they are enabled at
+ * compile time, and falls back to scalar code otherwise.
+ *
+ * @param src Pointer to the source samples.
+ * @param type The type of the source samples.
+ * @param dst Pointer to the destination samples. Must not overlap the source, unless both are 32-bit float.
+ * @param count The number of samples to convert (frames multiplied by channels).
+ * @return AM_TRUE if successful, AM_FALSE if the sample type is not supported.
+ */
+__api am_bool
+am_codec_samples_to_float32(const void* src, am_pcm_sample_type type, am_float32* dst, am_size count);
+
+/**
+ * @brief Convert 32-bit float samples to PCM samples.
+ *
+ * Source samples are clamped to the range [-1, 1] and rounded to the nearest integer.
+ *
+ * @param src Pointer to the source samples.
+ * @param type The type of the destination samples.
+ * @param dst Pointer to the destination samples. Must not overlap the source, unless both are 32-bit float.
+ * @param count The number of samples to convert (frames multiplied by channels).
+ * @return AM_TRUE if successful, AM_FALSE if the sample type is not supported.
+ */
+__api am_bool
+am_codec_samples_from_float32(const am_float32* src, am_pcm_sample_type type, void* dst, am_size count);
+
+/**
+ * @brief Interleave planar 32-bit float channels into a single buffer.
+ *
+ * @param src Array of @c num_channels pointers to the channel buffers.
+ * @param dst Pointer to the interleaved buffer, large enough for @c frames frames.
+ * @param num_channels The number of channels.
+ * @param frames The number of frames to interleave.
+ */
+__api void
+am_codec_samples_interleave(const am_float32* const* src, am_float32* dst, am_uint16 num_channels, am_size frames);
+
+/**
+ * @brief Split an interleaved 32-bit float buffer into planar channels.
+ *
+ * @param src Pointer to the interleaved buffer.
+ * @param dst Array of @c num_channels pointers to the channel buffers, each large enough for @c frames samples.
+ * @param num_channels The number of channels.
+ * @param frames The number of frames to deinterleave.
+ */
+__api void
+am_codec_samples_deinterleave(const am_float32* src, am_float32* const* dst, am_uint16 num_channels, am_size frames);
+
 // Utility functions
 
 /**
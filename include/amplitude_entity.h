@@ -17,6 +17,7 @@
 
 #include "amplitude_common.h"
 #include "amplitude_environment.h"
+#include "amplitude_listener.h"
 
 struct am_entity;
 
@@ -40,10 +41,114 @@ typedef am_entity* am_entity_handle;
  */
 typedef am_uint64 am_entity_id;
 
+/**
+ * @brief Called for each live entity by am_entity_for_each().
+ *
+ * @param[in] entity The entity.
+ * @param[in] user_data The user data given to am_entity_for_each().
+ */
+typedef void (*am_entity_visitor)(am_entity_handle entity, am_voidptr user_data);
+
+/**
+ * @brief Settings used to estimate how loud entities are for a listener.
+ *
+ * Attenuation is defined per sound in the engine, so the estimate uses a single inverse distance
+ * model which should match the attenuation of the sounds the entities play.
+ */
+typedef struct
+{
+    /**
+     * @brief Distance under which sounds are not attenuated.
+     */
+    am_float32 min_distance;
+
+    /**
+     * @brief Distance beyond which sounds are inaudible.
+     */
+    am_float32 max_distance;
+
+    /**
+     * @brief How fast the gain decreases between the min and max distances.
+     *
+     * The gain is min_distance / (min_distance + rolloff * (distance - min_distance)).
+     */
+    am_float32 rolloff;
+
+    /**
+     * @brief Gain of a fully obstructed entity, in the range [0, 1].
+     */
+    am_float32 obstruction_gain;
+
+    /**
+     * @brief Gain of a fully occluded entity, in the range [0, 1].
+     */
+    am_float32 occlusion_gain;
+
+    /**
+     * @brief Gain under which an entity is considered inaudible.
+     */
+    am_float32 threshold;
+} am_audibility_params;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Creates an entity in the engine, and adds it to the table of live entities.
+ *
+ * If the engine already has an entity with the given ID, that entity is returned.
+ *
+ * @param[in] id The unique ID of the entity. Must not be 0.
+ *
+ * @return The entity, or NULL if the engine could not create it.
+ */
+__api am_entity_handle
+am_entity_create(am_entity_id id);
+
+/**
+ * @brief Removes an entity from the engine and from the table of live entities.
+ *
+ * The entity is also removed from the velocity tracking, the change filter, the pending snapshot
+ * writes and the raycast service.
+ *
+ * @param[in] entity The entity to destroy. The handle is invalid after this call.
+ */
+__api void
+am_entity_destroy(am_entity_handle entity);
+
+/**
+ * @brief Gets the number of live entities created with am_entity_create().
+ */
+__api am_size
+am_entity_get_count(void);
+
+/**
+ * @brief Copies a range of the live entities created with am_entity_create().
+ *
+ * Live entities are stored contiguously. Destroying an entity moves the last one in its place, so
+ * the order changes when entities are destroyed.
+ *
+ * @param[out] out Receives the entities.
+ * @param[in] offset The index of the first entity to copy.
+ * @param[in] capacity The maximum number of entities to copy.
+ *
+ * @return The number of entities copied.
+ */
+__api am_size
+am_entity_get_all(am_entity_handle* out, am_size offset, am_size capacity);
+
+/**
+ * @brief Calls a function for each live entity created with am_entity_create().
+ *
+ * The table is locked while walking it, so the function must not create or destroy entities.
+ *
+ * @param[in] visitor The function to call.
+ * @param[in] user_data Given back to the function.
+ */
+__api void
+am_entity_for_each(am_entity_visitor visitor, am_voidptr user_data);
+
 /**
  * @brief Checks if an entity is valid.
  *
@@ -83,6 +188,44 @@ am_entity_get_velocity(am_entity_handle entity);
 __api void
 am_entity_set_location(am_entity_handle entity, am_vec3 location);
 
+/**
+ * @brief Sets the location of the entity at the given time, and updates its tracked velocity.
+ *
+ * The tracked velocity is derived from the elapsed time between updates rather than from the frame
+ * rate, smoothed, and protected against teleports, as configured with am_velocity_tracking_set_config().
+ *
+ * @param[in] entity The entity to set the location of.
+ * @param[in] location The location to set.
+ * @param[in] time The time of the location, in seconds, from any monotonic clock.
+ */
+__api void
+am_entity_set_location_at(am_entity_handle entity, am_vec3 location, am_time time);
+
+/**
+ * @brief Gets the velocity tracked from the locations set with am_entity_set_location_at().
+ *
+ * @note The tracked velocity is only computed by the bindings. The engine keeps deriving the
+ * velocity it uses for the Doppler effect from the location changes between its own updates, as
+ * returned by am_entity_get_velocity(), and the tracked velocity does not affect it. Use it for
+ * your own Doppler or gameplay computations.
+ *
+ * @param[in] entity The entity to get the velocity of.
+ *
+ * @return The tracked velocity, in units per second, or a zero velocity if no location was set yet.
+ */
+__api am_vec3
+am_entity_get_tracked_velocity(am_entity_handle entity);
+
+/**
+ * @brief Forgets the tracked locations of the entity.
+ *
+ * Call this when the entity is removed from the engine, or to restart the estimation from a zero velocity.
+ *
+ * @param[in] entity The entity to reset the tracked velocity of.
+ */
+__api void
+am_entity_reset_velocity_tracking(am_entity_handle entity);
+
 /**
  * @brief Gets the location of the entity.
  *
@@ -232,6 +375,33 @@ am_entity_get_environment_factor(am_entity_handle entity, am_environment_id envi
 __api am_uint64
 am_entity_get_active_channel_count(am_entity_handle entity);
 
+/**
+ * @brief Estimates the gain at which a listener hears several entities.
+ *
+ * The estimate combines the distance attenuation described by @c params, the obstruction and
+ * occlusion of each entity, the directivity of each entity towards the listener, and the
+ * directivity of the listener towards each entity. Use it to skip the updates of entities which
+ * can't be heard.
+ *
+ * Positions are transformed into listener space with the same vectorized kernel as
+ * am_listener_transform_points().
+ *
+ * @param[in] entities The entities to estimate the gain of. Invalid entities get a zero gain.
+ * @param[in] count The number of entities.
+ * @param[in] listener The listener hearing the entities.
+ * @param[in] params The attenuation settings.
+ * @param[out] out_gain_estimates The estimated gains, one per entity, in the range [0, 1].
+ *
+ * @return The number of entities with a gain greater than or equal to the threshold in @c params.
+ */
+__api am_size
+am_entity_compute_audibility(
+    const am_entity_handle* entities,
+    am_size count,
+    am_listener_handle listener,
+    const am_audibility_params* params,
+    am_float32* out_gain_estimates);
+
 #ifdef __cplusplus
 }
 #endif
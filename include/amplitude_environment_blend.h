@@ -0,0 +1,106 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _AM_C_ENVIRONMENT_BLEND_H
+#define _AM_C_ENVIRONMENT_BLEND_H
+
+#include "amplitude_common.h"
+#include "amplitude_entity.h"
+#include "amplitude_environment.h"
+
+/**
+ * @brief Configuration of the environment blender.
+ */
+typedef struct
+{
+    /**
+     * @brief Whether the factors of an entity are scaled down when their sum is greater than 1.
+     *
+     * When enabled, an entity inside several overlapping zones gets a weighted mix of their effects
+     * instead of the sum of their full effects.
+     */
+    am_bool normalize;
+
+    /**
+     * @brief The smallest change of a factor sent to the engine.
+     *
+     * Factors reaching 0 or 1 are always sent.
+     */
+    am_float32 min_delta;
+} am_environment_blend_config;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configures the environment blender.
+ *
+ * The blender computes the factor of every registered environment for every entity created with
+ * am_entity_create(), and sets them with am_entity_set_environment_factor(). The engine then mixes
+ * the effects of the environments affecting an entity with these factors as weights.
+ *
+ * @param[in] config The new configuration.
+ */
+__api void
+am_environment_blend_set_config(const am_environment_blend_config* config);
+
+/**
+ * @brief Gets the configuration of the environment blender.
+ *
+ * @param[out] config Receives the current configuration.
+ */
+__api void
+am_environment_blend_get_config(am_environment_blend_config* config);
+
+/**
+ * @brief Registers an environment in the blender. Does nothing if it is already registered.
+ *
+ * @param[in] environment The environment to blend.
+ */
+__api void
+am_environment_blend_register(am_environment_handle environment);
+
+/**
+ * @brief Removes an environment from the blender, and resets its factor to 0 on every live entity.
+ *
+ * @param[in] environment The environment to remove. Must be removed before the environment is
+ * removed from the engine.
+ */
+__api void
+am_environment_blend_unregister(am_environment_handle environment);
+
+/**
+ * @brief Computes and sets the environment factors of every live entity.
+ *
+ * Call this once per frame, from the thread which sets the entity states, after the entities and
+ * environments have moved. It replaces setting the factor of each entity for each environment.
+ *
+ * @return The number of factors sent to the engine.
+ */
+__api am_size
+am_environment_blend_update(void);
+
+/**
+ * @brief Gets the number of environments registered in the blender.
+ */
+__api am_size
+am_environment_blend_get_environment_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_ENVIRONMENT_BLEND_H
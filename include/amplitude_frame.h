@@ -0,0 +1,74 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_FRAME_H
+#define _AM_C_FRAME_H
+
+#include "amplitude_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enables or disables the snapshot mode.
+ *
+ * In snapshot mode, the entity and listener setters (location, orientation, obstruction, occlusion
+ * and directivity) don't write the engine state. They write into a back buffer instead, where
+ * successive writes to the same field of the same object are merged. am_frame_commit() then swaps
+ * the back buffer with an empty one and applies all the writes at once.
+ *
+ * Call am_frame_commit() from the thread which advances the engine, just before advancing it. The
+ * engine then never sees a half-written transform, whatever the threads the setters were called
+ * from, and every object state of a frame comes from the same game update.
+ *
+ * Getters keep reading the engine state, so they return the last committed values.
+ *
+ * @note am_entity_destroy() drops the pending writes of the entity, and waits for a running commit
+ * to finish before the entity is removed. Listeners, and entities removed from the engine without
+ * am_entity_destroy(), must be committed before being removed.
+ *
+ * @param[in] enabled Whether to enable the snapshot mode. Disabling it commits the pending writes.
+ */
+__api void
+am_frame_set_snapshot_mode(am_bool enabled);
+
+/**
+ * @brief Checks whether the snapshot mode is enabled.
+ */
+__api am_bool
+am_frame_is_snapshot_mode(void);
+
+/**
+ * @brief Applies the writes made since the last commit to the engine.
+ *
+ * The back buffer is swapped under a short lock, so setters called from other threads during the
+ * commit go to the next frame and never wait for the writes to be applied.
+ *
+ * @return The number of objects updated.
+ */
+__api am_size
+am_frame_commit(void);
+
+/**
+ * @brief Gets the number of objects with pending writes in the back buffer.
+ */
+__api am_size
+am_frame_get_pending_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_FRAME_H
@@ -92,6 +92,44 @@ am_listener_get_location(am_listener_handle listener);
 __api void
 am_listener_set_location(am_listener_handle listener, am_vec3 location);
 
+/**
+ * @brief Sets the location of the listener at the given time, and updates its tracked velocity.
+ *
+ * The tracked velocity is derived from the elapsed time between updates rather than from the frame
+ * rate, smoothed, and protected against teleports, as configured with am_velocity_tracking_set_config().
+ *
+ * @param[in] listener The listener to set the location of.
+ * @param[in] location The location to set.
+ * @param[in] time The time of the location, in seconds, from any monotonic clock.
+ */
+__api void
+am_listener_set_location_at(am_listener_handle listener, am_vec3 location, am_time time);
+
+/**
+ * @brief Gets the velocity tracked from the locations set with am_listener_set_location_at().
+ *
+ * @note The tracked velocity is only computed by the bindings. The engine keeps deriving the
+ * velocity it uses for the Doppler effect from the location changes between its own updates, as
+ * returned by am_listener_get_velocity(), and the tracked velocity does not affect it. Use it for
+ * your own Doppler or gameplay computations.
+ *
+ * @param[in] listener The listener to get the velocity of.
+ *
+ * @return The tracked velocity, in units per second, or a zero velocity if no location was set yet.
+ */
+__api am_vec3
+am_listener_get_tracked_velocity(am_listener_handle listener);
+
+/**
+ * @brief Forgets the tracked locations of the listener.
+ *
+ * Call this when the listener is removed from the engine, or to restart the estimation from a zero velocity.
+ *
+ * @param[in] listener The listener to reset the tracked velocity of.
+ */
+__api void
+am_listener_reset_velocity_tracking(am_listener_handle listener);
+
 /**
  * @brief Gets the direction vector of a listener.
  *
@@ -176,6 +214,91 @@ am_listener_get_directivity_sharpness(am_listener_handle listener);
 __api am_mat4
 am_listener_get_inverse_matrix(am_listener_handle listener);
 
+/**
+ * @brief Transforms positions from global space to the space of a listener.
+ *
+ * This is equivalent to multiplying each position by the matrix returned by
+ * am_listener_get_inverse_matrix(), using a vectorized kernel. In listener space, forward is -Z,
+ * up is +Y and right is +X.
+ *
+ * @param[in] listener The listener to transform the positions for.
+ * @param[in] in_positions The positions to transform, in global space.
+ * @param[out] out_positions The transformed positions. Can be the same array as @c in_positions.
+ * @param[in] count The number of positions.
+ */
+__api void
+am_listener_transform_points(
+    am_listener_handle listener, const am_vec3* in_positions, am_vec3* out_positions, am_size count);
+
+/**
+ * @brief Computes the distances and directions of positions relative to a listener.
+ *
+ * Every output is optional, and computed from the same vectorized transform as
+ * am_listener_transform_points().
+ *
+ * @param[in] listener The listener to compute the directions for.
+ * @param[in] in_positions The positions, in global space.
+ * @param[out] out_distances The distances to the listener, or NULL.
+ * @param[out] out_azimuths The angles from the listener's forward direction towards its right, in
+ * radians in the range [-PI, PI], or NULL.
+ * @param[out] out_elevations The angles above the listener's horizontal plane, in radians in the
+ * range [-PI/2, PI/2], or NULL.
+ * @param[in] count The number of positions.
+ */
+__api void
+am_listener_get_spherical_positions(
+    am_listener_handle listener,
+    const am_vec3* in_positions,
+    am_float32* out_distances,
+    am_float32* out_azimuths,
+    am_float32* out_elevations,
+    am_size count);
+
+/**
+ * @brief Sets the location, orientation and directivity of a listener at once.
+ *
+ * This is equivalent to calling am_listener_set_location(), am_listener_set_orientation() and
+ * am_listener_set_directivity() in sequence.
+ *
+ * @note The velocity of a listener is derived by the engine from its location updates.
+ *
+ * @param[in] listener The listener to update.
+ * @param[in] location The new location of the listener.
+ * @param[in] orientation The new orientation of the listener.
+ * @param[in] directivity The directivity of the listener, in the range [0, 1].
+ * @param[in] sharpness The directivity sharpness of the listener, in the range [1, +INF].
+ */
+__api void
+am_listener_set_state(
+    am_listener_handle listener, am_vec3 location, am_quaternion orientation, am_float32 directivity, am_float32 sharpness);
+
+/**
+ * @brief Sets the state of several listeners at once, and gets their updated inverse matrices.
+ *
+ * This is equivalent to calling am_listener_set_state() then am_listener_get_inverse_matrix() for
+ * each listener. The returned matrices are computed from the new states, so they don't lag behind
+ * until the next engine update.
+ *
+ * @param[in] listeners The listeners to update.
+ * @param[in] locations The new locations, one per listener.
+ * @param[in] orientations The new orientations, one per listener.
+ * @param[in] directivities The directivities, one per listener, or NULL to keep the current ones.
+ * @param[in] sharpnesses The directivity sharpnesses, one per listener, or NULL to keep the current
+ * ones. Directivities and sharpnesses are independent, either array may be NULL.
+ * @param[out] inverse_matrices The updated inverse matrices, one per listener, or NULL to skip the
+ * readback.
+ * @param[in] count The number of listeners.
+ */
+__api void
+am_listener_set_state_many(
+    const am_listener_handle* listeners,
+    const am_vec3* locations,
+    const am_quaternion* orientations,
+    const am_float32* directivities,
+    const am_float32* sharpnesses,
+    am_mat4* inverse_matrices,
+    am_size count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -153,6 +153,9 @@ am_memory_manager_initialize(const am_memory_allocator_vtable* config);
 
 /**
  * @brief Unloads the memory manager.
+ *
+ * The decoded sounds cache is emptied first, pinned sounds included, and the seek tables
+ * of closed files are released, since they live in the memory pools.
  */
 __api void
 am_memory_manager_deinitialize();
@@ -0,0 +1,137 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_RAYCAST_H
+#define _AM_C_RAYCAST_H
+
+#include "amplitude_common.h"
+#include "amplitude_entity.h"
+#include "amplitude_listener.h"
+
+/**
+ * @brief A ray to cast between an entity and a listener.
+ */
+typedef struct
+{
+    am_entity_handle entity; /**< The entity the ray is cast for */
+    am_vec3 from; /**< The location of the listener */
+    am_vec3 to; /**< The location of the entity */
+} am_raycast_request;
+
+/**
+ * @brief The result of a ray cast between an entity and a listener.
+ */
+typedef struct
+{
+    am_float32 obstruction; /**< The obstruction of the entity, in the range [0, 1] */
+    am_float32 occlusion; /**< The occlusion of the entity, in the range [0, 1] */
+} am_raycast_result;
+
+/**
+ * @brief Casts a batch of rays.
+ *
+ * @param[in] requests The rays to cast.
+ * @param[out] results The result of each ray, in the same order.
+ * @param[in] count The number of rays.
+ * @param[in] user_data The user data given in the service configuration.
+ */
+typedef void (*am_raycast_batch_callback)(
+    const am_raycast_request* requests, am_raycast_result* results, am_size count, am_voidptr user_data);
+
+/**
+ * @brief Configuration of the raycast service.
+ */
+typedef struct
+{
+    am_raycast_batch_callback callback; /**< Casts the rays scheduled by an update */
+    am_voidptr user_data; /**< Given back to the callback */
+
+    /**
+     * @brief The maximum number of rays cast by a single update.
+     */
+    am_uint32 max_rays_per_update;
+
+    /**
+     * @brief Time constant of the smoothing applied to the results, in seconds.
+     *
+     * Set to 0 to apply the results as they come.
+     */
+    am_float32 smoothing_time;
+} am_raycast_service_config;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configures the raycast service.
+ *
+ * The service computes the obstruction and occlusion of registered entities on a fixed ray budget.
+ * Each update picks the entities with the highest priority, casts their rays in a single call to
+ * the user callback, and moves the obstruction and occlusion of every registered entity towards
+ * its last result with am_entity_set_obstruction() and am_entity_set_occlusion().
+ *
+ * The priority of an entity grows with its loudness and with the time since its last ray, and
+ * decreases with its distance to the listener. Entities which never had a ray cast go first.
+ *
+ * @param[in] config The new configuration.
+ */
+__api void
+am_raycast_service_set_config(const am_raycast_service_config* config);
+
+/**
+ * @brief Registers an entity in the raycast service, or updates its loudness if already registered.
+ *
+ * @param[in] entity The entity to compute the obstruction and occlusion of.
+ * @param[in] loudness The relative loudness of the entity, used to prioritize its rays. Must be
+ * positive.
+ */
+__api void
+am_raycast_service_register_entity(am_entity_handle entity, am_float32 loudness);
+
+/**
+ * @brief Removes an entity from the raycast service.
+ *
+ * @param[in] entity The entity to remove. Must be removed before the entity is removed from the
+ * engine.
+ */
+__api void
+am_raycast_service_unregister_entity(am_entity_handle entity);
+
+/**
+ * @brief Casts the rays of the highest priority entities, and updates the obstruction and occlusion
+ * of all registered entities.
+ *
+ * Call this once per frame, from the thread which sets the entity states. The callback is called
+ * from this function, and must not call the raycast service.
+ *
+ * @param[in] listener The listener rays are cast from.
+ * @param[in] delta_time The time elapsed since the last update, in seconds.
+ *
+ * @return The number of rays cast.
+ */
+__api am_size
+am_raycast_service_update(am_listener_handle listener, am_time delta_time);
+
+/**
+ * @brief Gets the number of entities registered in the raycast service.
+ */
+__api am_size
+am_raycast_service_get_entity_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_RAYCAST_H
@@ -0,0 +1,111 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_STATS_H
+#define _AM_C_STATS_H
+
+#include "amplitude_common.h"
+
+/**
+ * @brief The number of buckets of the latency histograms.
+ *
+ * Bucket @c i counts the calls which took between 2^i and 2^(i+1) nanoseconds. The first bucket
+ * also counts calls faster than 1 ns, and the last one every call slower than 2^31 ns.
+ */
+#define AM_STATS_HISTOGRAM_BUCKETS 32
+
+/**
+ * @brief The families of C API functions for which statistics are collected.
+ */
+typedef enum am_stats_family : am_uint8
+{
+    am_stats_family_entity = 0,
+    am_stats_family_listener = 1,
+    am_stats_family_channel = 2,
+    am_stats_family_bus = 3,
+    am_stats_family_codec = 4,
+    am_stats_family_file = 5,
+    am_stats_family_filesystem = 6,
+    am_stats_family_thread = 7,
+    am_stats_family_max
+} am_stats_family;
+
+/**
+ * @brief Call statistics of a single family of functions.
+ */
+typedef struct
+{
+    am_uint64 calls; /**< Number of calls */
+    am_uint64 total_ns; /**< Total time spent in the calls, in nanoseconds */
+    am_uint64 max_ns; /**< Duration of the slowest call, in nanoseconds */
+    am_uint64 histogram[AM_STATS_HISTOGRAM_BUCKETS]; /**< Log2 latency histogram, see AM_STATS_HISTOGRAM_BUCKETS */
+} am_stats_family_stats;
+
+/**
+ * @brief Call statistics of all the families of functions.
+ */
+typedef struct
+{
+    am_stats_family_stats families[am_stats_family_max];
+} am_stats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checks whether call statistics were compiled in.
+ *
+ * Statistics are collected when the library is built with the @c AM_C_ENABLE_STATS define.
+ *
+ * @return AM_TRUE if statistics are available, AM_FALSE otherwise.
+ */
+__api am_bool
+am_stats_is_available(void);
+
+/**
+ * @brief Reads the call statistics collected since the start or the last reset.
+ *
+ * Only calls made directly by the application are counted, not the calls the C API makes
+ * to itself. Counters are updated without locking, so a snapshot taken while other threads
+ * make calls may be slightly inconsistent between families.
+ *
+ * @param[out] stats The statistics. Zeroed if statistics are not available.
+ *
+ * @return AM_TRUE if statistics are available, AM_FALSE otherwise.
+ */
+__api am_bool
+am_stats_snapshot(am_stats* stats);
+
+/**
+ * @brief Resets all the call statistics.
+ */
+__api void
+am_stats_reset(void);
+
+/**
+ * @brief Gets the name of the given family of functions.
+ *
+ * @param[in] family The family.
+ *
+ * @return The name, or nullptr if the family is not valid.
+ */
+__api const char*
+am_stats_get_family_name(am_stats_family family);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_STATS_H
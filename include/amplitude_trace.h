@@ -0,0 +1,85 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_TRACE_H
+#define _AM_C_TRACE_H
+
+#include "amplitude_common.h"
+#include "amplitude_file.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checks whether tracing support was compiled in.
+ *
+ * Tracing is enabled by building the library with the @c AM_C_ENABLE_TRACING define. When it is
+ * not, spans are compiled out and every other tracing function does nothing.
+ *
+ * @return AM_TRUE if tracing is available, AM_FALSE otherwise.
+ */
+__api am_bool
+am_trace_is_available(void);
+
+/**
+ * @brief Starts recording tracing spans.
+ *
+ * Spans are recorded by the codec stream and load calls, file reads, seeks and opens, thread pool
+ * tasks, and the filesystem open and close stages, into a fixed-size buffer per thread. Spans
+ * recorded after the buffer of a thread is full are dropped.
+ */
+__api void
+am_trace_start(void);
+
+/**
+ * @brief Stops recording tracing spans.
+ *
+ * Recorded spans are kept until @c am_trace_clear() is called.
+ */
+__api void
+am_trace_stop(void);
+
+/**
+ * @brief Discards all the recorded spans.
+ *
+ * @note This function does nothing while recording.
+ */
+__api void
+am_trace_clear(void);
+
+/**
+ * @brief Gets the number of spans which were dropped because a thread buffer was full.
+ */
+__api am_uint64
+am_trace_get_dropped_count(void);
+
+/**
+ * @brief Writes the recorded spans as Chrome trace JSON.
+ *
+ * The output can be opened in chrome://tracing or in the Perfetto UI.
+ *
+ * @param[in] file The file to write to. Must be opened for writing.
+ *
+ * @return AM_TRUE if the trace was written, AM_FALSE if tracing is not available or the file could
+ * not be written.
+ */
+__api am_bool
+am_trace_export(am_file_handle file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_TRACE_H
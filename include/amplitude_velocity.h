@@ -0,0 +1,80 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AM_C_VELOCITY_H
+#define _AM_C_VELOCITY_H
+
+#include "amplitude_common.h"
+
+/**
+ * @brief Settings of the velocity derived from timestamped location updates.
+ *
+ * Used by am_entity_set_location_at() and am_listener_set_location_at().
+ *
+ * The engine has no way to receive a velocity, so the tracked velocity does not change the Doppler
+ * effect computed by the engine. It is only returned by am_entity_get_tracked_velocity() and
+ * am_listener_get_tracked_velocity().
+ */
+typedef struct
+{
+    /**
+     * @brief Time constant of the exponential smoothing, in seconds.
+     *
+     * The velocity reaches ~63% of a sudden change after this time, whatever the update rate.
+     * Set to 0 to disable smoothing.
+     */
+    am_float32 smoothing_time;
+
+    /**
+     * @brief Speed above which a location update is considered a teleport, in units per second.
+     *
+     * A teleport moves the object without affecting its velocity. Set to 0 to disable the check.
+     */
+    am_float32 max_speed;
+
+    /**
+     * @brief Longest time between two updates, in seconds.
+     *
+     * Updates further apart restart the estimation with a zero velocity. Set to 0 to disable the check.
+     */
+    am_float32 max_time_step;
+} am_velocity_tracking_config;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets the velocity tracking settings used by entities and listeners.
+ *
+ * Defaults to a smoothing time of 0.1 s, a max speed of 100 units/s and a max time step of 0.5 s.
+ *
+ * @param[in] config The new settings.
+ */
+__api void
+am_velocity_tracking_set_config(const am_velocity_tracking_config* config);
+
+/**
+ * @brief Gets the velocity tracking settings used by entities and listeners.
+ *
+ * @param[out] config Receives the current settings.
+ */
+__api void
+am_velocity_tracking_get_config(am_velocity_tracking_config* config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AM_C_VELOCITY_H
@@ -16,51 +16,71 @@
 
 #include <amplitude_bus.h>
 
+#include "amplitude_capture.h"
 #include "amplitude_internals.h"
+#include "amplitude_stats.h"
 
 extern "C" {
 am_bool am_bus_is_valid(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusIsValid, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return BOOL_TO_AM_BOOL(b.Valid());
 }
 
 am_bus_id am_bus_get_id(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusGetId, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return b.GetId();
 }
 
 const char *am_bus_get_name(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusGetName, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return am_allocate_string(b.GetName());
 }
 
 void am_bus_set_gain(am_bus_handle bus, am_float32 gain) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusSetGain, AM_CAPTURE_HANDLE(Bus, bus), gain);
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   b.SetGain(gain);
 }
 
 am_float32 am_bus_get_gain(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusGetGain, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return b.GetGain();
 }
 
 void am_bus_fade_to(am_bus_handle bus, am_float32 target_gain,
                     am_time duration) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusFadeTo, AM_CAPTURE_HANDLE(Bus, bus), target_gain, duration);
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   b.FadeTo(target_gain, duration);
 }
 
 am_float32 am_bus_get_final_gain(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusGetFinalGain, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return b.GetFinalGain();
 }
 
 void am_bus_set_mute(am_bus_handle bus, am_bool mute) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusSetMute, AM_CAPTURE_HANDLE(Bus, bus), mute);
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   b.SetMute(mute);
 }
 
 am_bool am_bus_is_muted(am_bus_handle bus) {
+  AM_STATS_SCOPE(bus);
+  AM_CAPTURE(BusIsMuted, AM_CAPTURE_HANDLE(Bus, bus));
   const Bus b(reinterpret_cast<BusInternalState *>(bus));
   return b.IsMuted();
 }
@@ -0,0 +1,204 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_capture.h>
+
+#include "amplitude_capture.h"
+#include "amplitude_internals.h"
+
+static constexpr size_t kFlushSize = 1 << 16;
+
+std::atomic<bool> Capture::s_active = false;
+std::mutex Capture::s_mutex;
+thread_local std::uint32_t CaptureScope::s_depth = 0;
+
+// All the state below is guarded by Capture::s_mutex
+static File *g_file = nullptr;
+static std::vector<AmUInt8> g_buffer;
+static std::unordered_map<const void *, AmUInt32>
+    g_handles[kCaptureHandleKindCount];
+static AmUInt32 g_next_index[kCaptureHandleKindCount];
+static std::chrono::steady_clock::time_point g_last_time;
+static AmUInt64 g_calls = 0;
+static bool g_failed = false;
+
+static bool flush() {
+  if (g_buffer.empty())
+    return true;
+
+  if (g_file->Write(g_buffer.data(), g_buffer.size()) != g_buffer.size())
+    g_failed = true;
+
+  g_buffer.clear();
+  return !g_failed;
+}
+
+static void write_varint(AmUInt64 value) {
+  while (value >= 0x80) {
+    g_buffer.push_back(static_cast<AmUInt8>(value | 0x80));
+    value >>= 7;
+  }
+
+  g_buffer.push_back(static_cast<AmUInt8>(value));
+}
+
+static AmUInt64 get_object_id(CaptureHandleKind kind, const void *handle) {
+  auto *state = const_cast<void *>(handle);
+
+  switch (kind) {
+  case CaptureHandleKind::Entity:
+    return Entity(static_cast<EntityInternalState *>(state)).GetId();
+  case CaptureHandleKind::Listener:
+    return Listener(static_cast<ListenerInternalState *>(state)).GetId();
+  case CaptureHandleKind::Channel:
+    return Channel(static_cast<ChannelInternalState *>(state)).GetId();
+  case CaptureHandleKind::Bus:
+    return Bus(static_cast<BusInternalState *>(state)).GetId();
+  case CaptureHandleKind::Environment:
+    return Environment(static_cast<EnvironmentInternalState *>(state)).GetId();
+  case CaptureHandleKind::Room:
+    return Room(static_cast<RoomInternalState *>(state)).GetId();
+  }
+
+  return 0;
+}
+
+void Capture::WriteBytes(const void *data, std::size_t size) {
+  const auto *bytes = static_cast<const AmUInt8 *>(data);
+  g_buffer.insert(g_buffer.end(), bytes, bytes + size);
+}
+
+void Capture::Define(const CaptureHandle &handle) {
+  if (!handle.handle)
+    return;
+
+  auto &handles = g_handles[static_cast<size_t>(handle.kind)];
+  if (handles.contains(handle.handle))
+    return;
+
+  // Index 0 is the null handle. Indices are never reused, since forgotten
+  // handles may still be referenced by the replay
+  const AmUInt32 index = ++g_next_index[static_cast<size_t>(handle.kind)];
+  handles.emplace(handle.handle, index);
+
+  const AmUInt64 id = get_object_id(handle.kind, handle.handle);
+  g_buffer.push_back(kCaptureHandleTag);
+  g_buffer.push_back(static_cast<AmUInt8>(handle.kind));
+  write_varint(index);
+  WriteBytes(&id, sizeof(id));
+}
+
+void Capture::Forget(const CaptureHandle &handle) {
+  if (!IsActive())
+    return;
+
+  std::lock_guard lock(s_mutex);
+  g_handles[static_cast<size_t>(handle.kind)].erase(handle.handle);
+}
+
+void Capture::Write(const CaptureHandle &handle) {
+  if (!handle.handle) {
+    write_varint(0);
+    return;
+  }
+
+  write_varint(g_handles[static_cast<size_t>(handle.kind)].at(handle.handle));
+}
+
+void Capture::Write(const CaptureString &string) {
+  const AmSize length = string.value ? std::strlen(string.value) : 0;
+  write_varint(length);
+  WriteBytes(string.value, length);
+}
+
+void Capture::BeginRecord(CaptureCall call) {
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           now - g_last_time)
+                           .count();
+  g_last_time = now;
+
+  write_varint(static_cast<AmUInt64>(call));
+  write_varint(static_cast<AmUInt64>(std::max<std::int64_t>(elapsed, 0)));
+}
+
+void Capture::EndRecord() {
+  ++g_calls;
+
+  if (g_buffer.size() >= kFlushSize)
+    flush();
+}
+
+extern "C" {
+am_bool am_capture_start(am_file_handle file) {
+  if (!file.handle)
+    return AM_FALSE;
+
+  std::lock_guard lock(Capture::s_mutex);
+  if (g_file)
+    return AM_FALSE;
+
+  g_file = static_cast<File *>(file.handle);
+  g_buffer.clear();
+  g_buffer.reserve(kFlushSize * 2);
+  for (auto &handles : g_handles)
+    handles.clear();
+  for (auto &index : g_next_index)
+    index = 0;
+
+  g_calls = 0;
+  g_failed = false;
+  g_last_time = std::chrono::steady_clock::now();
+
+  g_buffer.insert(g_buffer.end(), std::begin(kCaptureMagic),
+                  std::end(kCaptureMagic));
+  const AmUInt32 version = kCaptureVersion;
+  const auto *bytes = reinterpret_cast<const AmUInt8 *>(&version);
+  g_buffer.insert(g_buffer.end(), bytes, bytes + sizeof(version));
+
+  Capture::s_active.store(true, std::memory_order_relaxed);
+  return AM_TRUE;
+}
+
+am_bool am_capture_stop(void) {
+  Capture::s_active.store(false, std::memory_order_relaxed);
+
+  std::lock_guard lock(Capture::s_mutex);
+  if (!g_file)
+    return AM_FALSE;
+
+  const bool written = flush();
+  g_file = nullptr;
+  g_buffer = {};
+
+  return BOOL_TO_AM_BOOL(written);
+}
+
+am_bool am_capture_is_active(void) {
+  return BOOL_TO_AM_BOOL(Capture::IsActive());
+}
+
+am_uint64 am_capture_get_call_count(void) {
+  std::lock_guard lock(Capture::s_mutex);
+  return g_calls;
+}
+}
@@ -0,0 +1,314 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_CAPTURE_H
+#define _AM_IMPLEMENTATION_CAPTURE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include <amplitude.h>
+
+/**
+ * Capture log format, all values little-endian:
+ *
+ * - Header: the "AMCP" magic, then the format version as a 32-bit integer.
+ * - Records, until the end of the file. Each record starts with a tag byte:
+ *   - kCaptureHandleTag: a handle seen for the first time. Followed by its kind (one byte), its
+ *     index as a varint, and its engine identifier as a 64-bit integer.
+ *   - Any CaptureCall value, as a varint: a call. Followed by the nanoseconds elapsed since the
+ *     previous record as a varint, then its arguments in declaration order. Handles are written as
+ *     varint indices, strings as a varint length followed by their bytes, other values with their
+ *     in-memory size.
+ *
+ * Version 1 logs wrote the call as a single byte, and only held entity, listener, channel and bus
+ * calls.
+ */
+static constexpr std::uint8_t kCaptureMagic[4] = { 'A', 'M', 'C', 'P' };
+static constexpr std::uint32_t kCaptureVersion = 2;
+static constexpr std::uint8_t kCaptureHandleTag = 0;
+
+enum class CaptureHandleKind : std::uint8_t
+{
+    Entity = 0,
+    Listener = 1,
+    Channel = 2,
+    Bus = 3,
+    Environment = 4,
+    Room = 5,
+};
+
+static constexpr std::size_t kCaptureHandleKindCount = 6;
+
+/**
+ * @brief Identifiers of the recorded calls. Values are part of the log format and must not change.
+ *
+ * Each family of calls owns a block of 64 values.
+ */
+enum class CaptureCall : std::uint16_t
+{
+    EntityIsValid = 1,
+    EntityGetId = 2,
+    EntityGetVelocity = 3,
+    EntitySetLocation = 4,
+    EntityGetLocation = 5,
+    EntitySetOrientation = 6,
+    EntityGetDirection = 7,
+    EntityGetUp = 8,
+    EntityGetOrientation = 9,
+    EntitySetObstruction = 10,
+    EntitySetOcclusion = 11,
+    EntitySetDirectivity = 12,
+    EntityGetObstruction = 13,
+    EntityGetOcclusion = 14,
+    EntityGetDirectivity = 15,
+    EntityGetDirectivitySharpness = 16,
+    EntitySetEnvironmentFactor = 17,
+    EntityGetEnvironmentFactor = 18,
+    EntityGetActiveChannelCount = 19,
+    EntitySetLocationAt = 20,
+    EntityGetTrackedVelocity = 21,
+    EntityResetVelocityTracking = 22,
+    EntityCreate = 23,
+    EntityDestroy = 24,
+    EntityGetCount = 25,
+
+    ListenerIsValid = 64,
+    ListenerGetId = 65,
+    ListenerGetVelocity = 66,
+    ListenerGetLocation = 67,
+    ListenerSetLocation = 68,
+    ListenerGetDirection = 69,
+    ListenerGetUp = 70,
+    ListenerSetOrientation = 71,
+    ListenerGetOrientation = 72,
+    ListenerSetDirectivity = 73,
+    ListenerGetDirectivity = 74,
+    ListenerGetDirectivitySharpness = 75,
+    ListenerGetInverseMatrix = 76,
+    ListenerSetState = 77,
+    ListenerSetLocationAt = 78,
+    ListenerGetTrackedVelocity = 79,
+    ListenerResetVelocityTracking = 80,
+
+    ChannelIsValid = 128,
+    ChannelGetId = 129,
+    ChannelPlaying = 130,
+    ChannelStop = 131,
+    ChannelStopTimeout = 132,
+    ChannelPause = 133,
+    ChannelPauseTimeout = 134,
+    ChannelResume = 135,
+    ChannelResumeTimeout = 136,
+    ChannelGetLocation = 137,
+    ChannelSetLocation = 138,
+    ChannelGetGain = 139,
+    ChannelSetGain = 140,
+    ChannelGetPlaybackState = 141,
+
+    BusIsValid = 192,
+    BusGetId = 193,
+    BusGetName = 194,
+    BusSetGain = 195,
+    BusGetGain = 196,
+    BusFadeTo = 197,
+    BusGetFinalGain = 198,
+    BusSetMute = 199,
+    BusIsMuted = 200,
+
+    EnvironmentIsValid = 256,
+    EnvironmentGetId = 257,
+    EnvironmentSetLocation = 258,
+    EnvironmentGetLocation = 259,
+    EnvironmentSetOrientation = 260,
+    EnvironmentGetOrientation = 261,
+    EnvironmentGetDirection = 262,
+    EnvironmentGetUp = 263,
+    EnvironmentGetFactorForLocation = 264,
+    EnvironmentGetFactorForEntity = 265,
+    EnvironmentSetEffectById = 266,
+    EnvironmentSetEffectByName = 267,
+    EnvironmentSetEffect = 268,
+    EnvironmentGetEffect = 269,
+    EnvironmentSetZone = 270,
+    EnvironmentGetZone = 271,
+
+    RoomWallMaterialCreate = 320,
+    RoomWallMaterialCreateWithType = 321,
+    RoomIsValid = 322,
+    RoomGetId = 323,
+    RoomSetLocation = 324,
+    RoomGetLocation = 325,
+    RoomSetOrientation = 326,
+    RoomGetOrientation = 327,
+    RoomGetDirection = 328,
+    RoomGetUp = 329,
+    RoomSetDimensions = 330,
+    RoomSetShape = 331,
+    RoomGetShape = 332,
+    RoomSetWallMaterial = 333,
+    RoomSetAllWallMaterials = 334,
+    RoomSetWallMaterials = 335,
+    RoomGetWallMaterial = 336,
+    RoomSetGain = 337,
+    RoomGetGain = 338,
+    RoomGetVolume = 339,
+    RoomGetDimensions = 340,
+    RoomGetSurfaceArea = 341,
+
+    FrameSetSnapshotMode = 384,
+    FrameIsSnapshotMode = 385,
+    FrameCommit = 386,
+    FrameGetPendingCount = 387,
+
+    ChangeFilterSetEnabled = 448,
+    ChangeFilterIsEnabled = 449,
+    ChangeFilterSetConfig = 450,
+    ChangeFilterGetConfig = 451,
+    ChangeFilterGetStats = 452,
+    ChangeFilterResetStats = 453,
+    ChangeFilterForget = 454,
+    ChangeFilterClear = 455,
+
+    VelocityTrackingSetConfig = 512,
+    VelocityTrackingGetConfig = 513,
+
+    RaycastServiceSetConfig = 576,
+    RaycastServiceRegisterEntity = 577,
+    RaycastServiceUnregisterEntity = 578,
+    RaycastServiceUpdate = 579,
+    RaycastServiceGetEntityCount = 580,
+
+    EnvironmentBlendSetConfig = 640,
+    EnvironmentBlendGetConfig = 641,
+    EnvironmentBlendRegister = 642,
+    EnvironmentBlendUnregister = 643,
+    EnvironmentBlendUpdate = 644,
+    EnvironmentBlendGetEnvironmentCount = 645,
+};
+
+/**
+ * @brief The largest CaptureCall value, plus one.
+ */
+static constexpr std::size_t kCaptureCallCount = 704;
+
+/**
+ * @brief A handle argument of a recorded call.
+ */
+struct CaptureHandle
+{
+    CaptureHandleKind kind;
+    const void* handle;
+};
+
+/**
+ * @brief A string argument of a recorded call.
+ */
+struct CaptureString
+{
+    const char* value;
+};
+
+/**
+ * @brief Writes the C API calls into the capture log, while a capture is running.
+ */
+class Capture
+{
+public:
+    [[nodiscard]] static bool IsActive()
+    {
+        return s_active.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Forgets a destroyed handle, so a new object at the same address gets a new index.
+     */
+    static void Forget(const CaptureHandle& handle);
+
+    /**
+     * @brief Records a call and its arguments.
+     */
+    template<typename... Args>
+    static void Record(CaptureCall call, const Args&... args)
+    {
+        std::lock_guard lock(s_mutex);
+        if (!IsActive())
+            return;
+
+        (Define(args), ...);
+        BeginRecord(call);
+        (Write(args), ...);
+        EndRecord();
+    }
+
+    static std::atomic<bool> s_active;
+    static std::mutex s_mutex;
+
+private:
+    static void BeginRecord(CaptureCall call);
+    static void EndRecord();
+    static void WriteBytes(const void* data, std::size_t size);
+    static void Define(const CaptureHandle& handle);
+    static void Write(const CaptureHandle& handle);
+    static void Write(const CaptureString& string);
+
+    template<typename T>
+    static void Define(const T&)
+    {}
+
+    template<typename T>
+    static void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        WriteBytes(&value, sizeof(T));
+    }
+};
+
+/**
+ * @brief Records a call when it is made by the application, not by another C API function.
+ */
+class CaptureScope
+{
+public:
+    template<typename... Args>
+    explicit CaptureScope(CaptureCall call, const Args&... args)
+    {
+        if (s_depth++ == 0 && Capture::IsActive())
+            Capture::Record(call, args...);
+    }
+
+    ~CaptureScope()
+    {
+        --s_depth;
+    }
+
+    CaptureScope(const CaptureScope&) = delete;
+    CaptureScope& operator=(const CaptureScope&) = delete;
+
+private:
+    static thread_local std::uint32_t s_depth;
+};
+
+#define AM_CAPTURE_HANDLE(kind, handle) (CaptureHandle{ CaptureHandleKind::kind, handle })
+#define AM_CAPTURE_CONCAT_IMPL(a, b) a##b
+#define AM_CAPTURE_CONCAT(a, b) AM_CAPTURE_CONCAT_IMPL(a, b)
+#define AM_CAPTURE(call, ...) const CaptureScope AM_CAPTURE_CONCAT(_am_capture_scope_, __LINE__)(CaptureCall::call, __VA_ARGS__)
+#define AM_CAPTURE_CALL(call) const CaptureScope AM_CAPTURE_CONCAT(_am_capture_scope_, __LINE__)(CaptureCall::call)
+
+#endif // _AM_IMPLEMENTATION_CAPTURE_H
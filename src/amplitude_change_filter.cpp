@@ -0,0 +1,253 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "amplitude_capture.h"
+#include "amplitude_change_filter.h"
+#include "amplitude_internals.h"
+
+static constexpr am_uint8 field_bit(am_change_filter_field field) {
+  return static_cast<am_uint8>(1u << field);
+}
+
+ChangeFilter &ChangeFilter::Instance() {
+  static ChangeFilter filter;
+  return filter;
+}
+
+void ChangeFilter::SetEnabled(bool enabled) {
+  std::lock_guard lock(_mutex);
+  _enabled.store(enabled, std::memory_order_relaxed);
+
+  if (!enabled) {
+    _records.clear();
+    _keys.clear();
+    _index.clear();
+  }
+}
+
+void ChangeFilter::SetConfig(const am_change_filter_config &config) {
+  std::lock_guard lock(_mutex);
+  _config = config;
+}
+
+am_change_filter_config ChangeFilter::GetConfig() const {
+  std::lock_guard lock(_mutex);
+  return _config;
+}
+
+ChangeFilter::Record &ChangeFilter::FindOrAdd(const void *key) {
+  const auto [it, inserted] =
+      _index.try_emplace(key, static_cast<am_uint32>(_records.size()));
+
+  if (inserted) {
+    _records.push_back({});
+    _keys.push_back(key);
+  }
+
+  return _records[it->second];
+}
+
+bool ChangeFilter::Count(am_change_filter_field field, bool send) {
+  _submitted[field].fetch_add(1, std::memory_order_relaxed);
+  if (!send)
+    _skipped[field].fetch_add(1, std::memory_order_relaxed);
+
+  return send;
+}
+
+bool ChangeFilter::ShouldSendLocation(const void *key,
+                                      const am_vec3 &location) {
+  if (!IsEnabled())
+    return true;
+
+  std::lock_guard lock(_mutex);
+  Record &record = FindOrAdd(key);
+
+  constexpr am_uint8 bit = field_bit(am_change_filter_field_location);
+  const am_float32 epsilon = _config.location_epsilon;
+
+  if ((record.cached & bit) &&
+      std::abs(location.x - record.location.x) <= epsilon &&
+      std::abs(location.y - record.location.y) <= epsilon &&
+      std::abs(location.z - record.location.z) <= epsilon)
+    return Count(am_change_filter_field_location, false);
+
+  record.location = location;
+  record.cached |= bit;
+  return Count(am_change_filter_field_location, true);
+}
+
+bool ChangeFilter::ShouldSendOrientation(const void *key,
+                                         const am_quaternion &orientation) {
+  if (!IsEnabled())
+    return true;
+
+  std::lock_guard lock(_mutex);
+  Record &record = FindOrAdd(key);
+
+  constexpr am_uint8 bit = field_bit(am_change_filter_field_orientation);
+
+  // q and -q are the same rotation
+  if (record.cached & bit) {
+    const am_quaternion &last = record.orientation;
+    const am_float32 dot = orientation.w * last.w + orientation.x * last.x +
+                           orientation.y * last.y + orientation.z * last.z;
+    if (1.0f - std::abs(dot) <= _config.orientation_epsilon)
+      return Count(am_change_filter_field_orientation, false);
+  }
+
+  record.orientation = orientation;
+  record.cached |= bit;
+  return Count(am_change_filter_field_orientation, true);
+}
+
+bool ChangeFilter::ShouldSendScalar(const void *key,
+                                    am_change_filter_field field,
+                                    am_float32 value) {
+  if (!IsEnabled())
+    return true;
+
+  std::lock_guard lock(_mutex);
+  Record &record = FindOrAdd(key);
+
+  const am_uint8 bit = field_bit(field);
+  am_float32 &last = field == am_change_filter_field_obstruction
+                         ? record.obstruction
+                         : record.occlusion;
+
+  if ((record.cached & bit) &&
+      std::abs(value - last) <= _config.scalar_epsilon)
+    return Count(field, false);
+
+  last = value;
+  record.cached |= bit;
+  return Count(field, true);
+}
+
+bool ChangeFilter::ShouldSendDirectivity(const void *key,
+                                         am_float32 directivity,
+                                         am_float32 sharpness) {
+  if (!IsEnabled())
+    return true;
+
+  std::lock_guard lock(_mutex);
+  Record &record = FindOrAdd(key);
+
+  constexpr am_uint8 bit = field_bit(am_change_filter_field_directivity);
+  const am_float32 epsilon = _config.scalar_epsilon;
+
+  if ((record.cached & bit) &&
+      std::abs(directivity - record.directivity) <= epsilon &&
+      std::abs(sharpness - record.sharpness) <= epsilon)
+    return Count(am_change_filter_field_directivity, false);
+
+  record.directivity = directivity;
+  record.sharpness = sharpness;
+  record.cached |= bit;
+  return Count(am_change_filter_field_directivity, true);
+}
+
+void ChangeFilter::Forget(const void *key) {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _index.find(key);
+  if (it == _index.end())
+    return;
+
+  // Keep the records dense by moving the last one into the hole
+  const am_uint32 index = it->second;
+  const am_uint32 last = static_cast<am_uint32>(_records.size() - 1);
+  if (index != last) {
+    _records[index] = _records[last];
+    _keys[index] = _keys[last];
+    _index[_keys[index]] = index;
+  }
+
+  _records.pop_back();
+  _keys.pop_back();
+  _index.erase(it);
+}
+
+void ChangeFilter::Clear() {
+  std::lock_guard lock(_mutex);
+  _records.clear();
+  _keys.clear();
+  _index.clear();
+}
+
+am_change_filter_stats ChangeFilter::GetStats() const {
+  am_change_filter_stats stats;
+  for (int f = 0; f < am_change_filter_field_max; ++f) {
+    stats.submitted[f] = _submitted[f].load(std::memory_order_relaxed);
+    stats.skipped[f] = _skipped[f].load(std::memory_order_relaxed);
+  }
+
+  return stats;
+}
+
+void ChangeFilter::ResetStats() {
+  for (int f = 0; f < am_change_filter_field_max; ++f) {
+    _submitted[f].store(0, std::memory_order_relaxed);
+    _skipped[f].store(0, std::memory_order_relaxed);
+  }
+}
+
+extern "C" {
+void am_change_filter_set_enabled(am_bool enabled) {
+  AM_CAPTURE(ChangeFilterSetEnabled, enabled);
+  ChangeFilter::Instance().SetEnabled(AM_BOOL_TO_BOOL(enabled));
+}
+
+am_bool am_change_filter_is_enabled(void) {
+  AM_CAPTURE_CALL(ChangeFilterIsEnabled);
+  return BOOL_TO_AM_BOOL(ChangeFilter::Instance().IsEnabled());
+}
+
+void am_change_filter_set_config(const am_change_filter_config *config) {
+  if (!config)
+    return;
+
+  AM_CAPTURE(ChangeFilterSetConfig, *config);
+  ChangeFilter::Instance().SetConfig(*config);
+}
+
+void am_change_filter_get_config(am_change_filter_config *config) {
+  AM_CAPTURE_CALL(ChangeFilterGetConfig);
+  if (config)
+    *config = ChangeFilter::Instance().GetConfig();
+}
+
+void am_change_filter_get_stats(am_change_filter_stats *stats) {
+  AM_CAPTURE_CALL(ChangeFilterGetStats);
+  if (stats)
+    *stats = ChangeFilter::Instance().GetStats();
+}
+
+void am_change_filter_reset_stats(void) {
+  AM_CAPTURE_CALL(ChangeFilterResetStats);
+  ChangeFilter::Instance().ResetStats();
+}
+
+void am_change_filter_forget(am_entity_handle entity) {
+  AM_CAPTURE(ChangeFilterForget, AM_CAPTURE_HANDLE(Entity, entity));
+  ChangeFilter::Instance().Forget(entity);
+}
+
+void am_change_filter_clear(void) {
+  AM_CAPTURE_CALL(ChangeFilterClear);
+  ChangeFilter::Instance().Clear();
+}
+}
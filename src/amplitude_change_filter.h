@@ -0,0 +1,118 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_CHANGE_FILTER_H
+#define _AM_CHANGE_FILTER_H
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <amplitude_change_filter.h>
+
+/**
+ * @brief Drops entity setter values which are within a tolerance of the last value sent to the engine.
+ *
+ * The last sent values are kept in a dense array, indexed through a map from entity handles, and
+ * removed by swapping with the last record. Only sent values are cached, so slow drifts are still
+ * sent once they exceed the tolerance.
+ */
+class ChangeFilter
+{
+public:
+    ChangeFilter(const ChangeFilter&) = delete;
+    ChangeFilter& operator=(const ChangeFilter&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static ChangeFilter& Instance();
+
+    [[nodiscard]] bool IsEnabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void SetEnabled(bool enabled);
+
+    void SetConfig(const am_change_filter_config& config);
+
+    [[nodiscard]] am_change_filter_config GetConfig() const;
+
+    /**
+     * @brief Checks whether a location must be sent to the engine, and caches it if so.
+     *
+     * Always returns true when the filter is disabled.
+     */
+    bool ShouldSendLocation(const void* key, const am_vec3& location);
+
+    /**
+     * @brief Checks whether an orientation must be sent to the engine, and caches it if so.
+     */
+    bool ShouldSendOrientation(const void* key, const am_quaternion& orientation);
+
+    /**
+     * @brief Checks whether an obstruction or occlusion value must be sent to the engine, and caches it if so.
+     */
+    bool ShouldSendScalar(const void* key, am_change_filter_field field, am_float32 value);
+
+    /**
+     * @brief Checks whether a directivity must be sent to the engine, and caches it if so.
+     */
+    bool ShouldSendDirectivity(const void* key, am_float32 directivity, am_float32 sharpness);
+
+    void Forget(const void* key);
+
+    void Clear();
+
+    [[nodiscard]] am_change_filter_stats GetStats() const;
+
+    void ResetStats();
+
+private:
+    struct Record
+    {
+        am_vec3 location;
+        am_quaternion orientation;
+        am_float32 obstruction;
+        am_float32 occlusion;
+        am_float32 directivity;
+        am_float32 sharpness;
+        am_uint8 cached; // One bit per am_change_filter_field
+    };
+
+    ChangeFilter() = default;
+
+    Record& FindOrAdd(const void* key);
+
+    // Updates the counters of a field, and returns whether the value was sent
+    bool Count(am_change_filter_field field, bool send);
+
+    std::vector<Record> _records;
+    std::vector<const void*> _keys; // Same order as _records
+    std::unordered_map<const void*, am_uint32> _index;
+
+    am_change_filter_config _config = { 1e-4f, 1e-6f, 1e-4f };
+    std::atomic<bool> _enabled = false;
+
+    std::atomic<am_uint64> _submitted[am_change_filter_field_max] = {};
+    std::atomic<am_uint64> _skipped[am_change_filter_field_max] = {};
+
+    mutable std::mutex _mutex;
+};
+
+#endif // _AM_CHANGE_FILTER_H
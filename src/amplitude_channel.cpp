@@ -16,80 +16,113 @@
 
 #include <amplitude_channel.h>
 
+#include "amplitude_capture.h"
 #include "amplitude_internals.h"
+#include "amplitude_stats.h"
 
 extern "C" {
 am_bool am_channel_is_valid(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelIsValid, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   return BOOL_TO_AM_BOOL(c.Valid());
 }
 
 am_channel_id am_channel_get_id(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelGetId, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   return c.GetId();
 }
 
 am_bool am_channel_playing(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelPlaying, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   return BOOL_TO_AM_BOOL(c.Playing());
 }
 
 void am_channel_stop(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelStop, AM_CAPTURE_HANDLE(Channel, channel));
   am_channel_stop_timeout(channel, kMinFadeDuration);
 }
 
 void am_channel_stop_timeout(am_channel_handle channel, am_time duration) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelStopTimeout, AM_CAPTURE_HANDLE(Channel, channel), duration);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.Stop(duration);
 }
 
 void am_channel_pause(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelPause, AM_CAPTURE_HANDLE(Channel, channel));
   am_channel_pause_timeout(channel, kMinFadeDuration);
 }
 
 void am_channel_pause_timeout(am_channel_handle channel, am_time duration) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelPauseTimeout, AM_CAPTURE_HANDLE(Channel, channel),
+             duration);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.Pause(duration);
 }
 
 void am_channel_resume(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelResume, AM_CAPTURE_HANDLE(Channel, channel));
   am_channel_resume_timeout(channel, kMinFadeDuration);
 }
 
 void am_channel_resume_timeout(am_channel_handle channel, am_time duration) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelResumeTimeout, AM_CAPTURE_HANDLE(Channel, channel),
+             duration);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.Resume(duration);
 }
 
 am_vec3 am_channel_get_location(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelGetLocation, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   const auto &vec = c.GetLocation();
   return from_cpp(vec);
 }
 
 void am_channel_set_location(am_channel_handle channel, am_vec3 location) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelSetLocation, AM_CAPTURE_HANDLE(Channel, channel), location);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.SetLocation(to_cpp(location));
 }
 
 am_float32 am_channel_get_gain(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelGetGain, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   return c.GetGain();
 }
 
 void am_channel_set_gain(am_channel_handle channel, am_float32 gain) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelSetGain, AM_CAPTURE_HANDLE(Channel, channel), gain);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.SetGain(gain);
 }
 
 am_channel_playback_state
 am_channel_get_playback_state(am_channel_handle channel) {
+  AM_STATS_SCOPE(channel);
+  AM_CAPTURE(ChannelGetPlaybackState, AM_CAPTURE_HANDLE(Channel, channel));
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   return static_cast<am_channel_playback_state>(c.GetPlaybackState());
 }
 
 void am_channel_on_event(am_channel_handle channel, am_channel_event event,
                          am_channel_event_callback callback, void *user_data) {
+  AM_STATS_SCOPE(channel);
   const Channel c(reinterpret_cast<ChannelInternalState *>(channel));
   c.On(
       static_cast<eChannelEvent>(event),
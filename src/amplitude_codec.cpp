@@ -12,227 +12,199 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
 #include <amplitude_codec.h>
 
-#include "amplitude_internals.h"
+#include "amplitude_codec_internals.h"
+#include "amplitude_decoded_sound_cache.h"
+#include "amplitude_stats.h"
+#include "amplitude_trace.h"
 
 using namespace SparkyStudios::Audio::Amplitude;
 
-// Helper functions for format conversion
-static eAudioSampleFormat to_cpp_sample_format(am_audio_sample_format format) {
-  switch (format) {
-  case am_audio_sample_format_float32:
-    return eAudioSampleFormat_Float32;
-  case am_audio_sample_format_int16:
-    return eAudioSampleFormat_Int16;
-  case am_audio_sample_format_unknown:
-  default:
-    return eAudioSampleFormat_Unknown;
-  }
-}
+// Signatures must fit in the header read once per probed file
+static constexpr AmSize kMaxCodecSignatureEnd = 64;
 
-static am_audio_sample_format
-from_cpp_sample_format(eAudioSampleFormat format) {
-  switch (format) {
-  case eAudioSampleFormat_Float32:
-    return am_audio_sample_format_float32;
-  case eAudioSampleFormat_Int16:
-    return am_audio_sample_format_int16;
-  case eAudioSampleFormat_Unknown:
-  default:
-    return am_audio_sample_format_unknown;
-  }
-}
+struct CodecSignature {
+  AmString codec;
+  std::vector<AmUInt8> magic;
+  AmSize offset;
+};
 
-static SoundFormat to_cpp_sound_format(const am_sound_format &format) {
-  SoundFormat result;
-  result.SetAll(format.sample_rate, format.num_channels, format.bits_per_sample,
-                format.frames_count, format.frame_size,
-                to_cpp_sample_format(format.sample_type));
-  return result;
-}
+struct ProbeCacheEntry {
+  AmString codec;
+  std::list<AmOsString>::iterator lru;
+};
 
-static am_sound_format from_cpp_sound_format(const SoundFormat &format) {
-  am_sound_format result;
-  result.sample_rate = format.GetSampleRate();
-  result.num_channels = format.GetNumChannels();
-  result.bits_per_sample = format.GetBitsPerSample();
-  result.frames_count = format.GetFramesCount();
-  result.frame_size = format.GetFrameSize();
-  result.sample_type = from_cpp_sample_format(format.GetSampleType());
-  return result;
+static std::shared_mutex g_probe_mutex;
+static std::vector<CodecSignature> g_probe_signatures = {};
+static AmSize g_probe_header_size = 0;
+
+// All the state below is guarded by g_probe_cache_mutex. When both are held,
+// g_probe_mutex is locked first
+static std::mutex g_probe_cache_mutex;
+static std::unordered_map<AmOsString, ProbeCacheEntry> g_probe_cache = {};
+static std::list<AmOsString> g_probe_cache_lru; // Most recently used first
+static AmSize g_probe_cache_capacity = 1024;
+
+static void clear_probe_cache() {
+  std::lock_guard lock(g_probe_cache_mutex);
+  g_probe_cache.clear();
+  g_probe_cache_lru.clear();
 }
 
-class CCodec final : public Codec {
-public:
-  class CDecoder final : public Decoder {
-  public:
-    CDecoder(const Codec *codec, am_codec_decoder_vtable *v_table,
-             am_voidptr user_data = nullptr)
-        : Decoder(codec), _v_table(v_table), _user_data(user_data) {
-      if (_v_table && _v_table->create)
-        _v_table->create(_user_data);
-    }
-
-    ~CDecoder() override {
-      if (_v_table && _v_table->destroy)
-        _v_table->destroy(_user_data);
-
-      _v_table = nullptr;
-      _user_data = nullptr;
-    }
-
-    bool Open(std::shared_ptr<File> file) override {
-      if (!_v_table || !_v_table->open || !file)
-        return false;
-
-      am_file_handle handle = {am_file_type_unknown, file.get()};
-      bool result = AM_BOOL_TO_BOOL(_v_table->open(_user_data, handle));
+// Releases the least recently used paths until the capacity is met
+static void evict_probe_cache() {
+  while (g_probe_cache.size() > g_probe_cache_capacity) {
+    g_probe_cache.erase(g_probe_cache_lru.back());
+    g_probe_cache_lru.pop_back();
+  }
+}
 
-      // Update format after opening
-      if (result && _v_table->get_format) {
-        am_sound_format format;
-        _v_table->get_format(_user_data, &format);
-        m_format = to_cpp_sound_format(format);
-      }
+static bool find_cached_probe(const AmOsString &path, AmString &codec) {
+  std::lock_guard lock(g_probe_cache_mutex);
 
-      return result;
-    }
+  const auto it = g_probe_cache.find(path);
+  if (it == g_probe_cache.end())
+    return false;
 
-    bool Close() override {
-      if (!_v_table || !_v_table->close)
-        return false;
+  g_probe_cache_lru.splice(g_probe_cache_lru.begin(), g_probe_cache_lru,
+                           it->second.lru);
+  codec = it->second.codec;
+  return true;
+}
 
-      return AM_BOOL_TO_BOOL(_v_table->close(_user_data));
-    }
+static void cache_probe(const AmOsString &path, const AmString &codec) {
+  std::lock_guard lock(g_probe_cache_mutex);
 
-    AmUInt64 Load(AudioBuffer *out) override {
-      if (!_v_table || !_v_table->load || !out)
-        return 0;
+  if (const auto it = g_probe_cache.find(path); it != g_probe_cache.end()) {
+    g_probe_cache_lru.splice(g_probe_cache_lru.begin(), g_probe_cache_lru,
+                             it->second.lru);
+    it->second.codec = codec;
+    return;
+  }
 
-      return _v_table->load(_user_data, out->GetData().GetBuffer());
-    }
+  g_probe_cache_lru.push_front(path);
+  g_probe_cache.emplace(path,
+                        ProbeCacheEntry{codec, g_probe_cache_lru.begin()});
+  evict_probe_cache();
+}
 
-    AmUInt64 Stream(AudioBuffer *out, AmUInt64 bufferOffset,
-                    AmUInt64 seekOffset, AmUInt64 length) override {
-      if (!_v_table || !_v_table->stream || !out)
-        return 0;
+static std::shared_ptr<Codec> find_codec_by_signature(File *file) {
+  std::shared_lock lock(g_probe_mutex);
 
-      return _v_table->stream(_user_data, out->GetData().GetBuffer(),
-                              bufferOffset, seekOffset, length);
-    }
+  if (g_probe_signatures.empty())
+    return nullptr;
 
-    bool Seek(AmUInt64 offset) override {
-      if (!_v_table || !_v_table->seek)
-        return false;
+  AmUInt8 header[kMaxCodecSignatureEnd];
+  const AmSize position = file->Position();
 
-      return AM_BOOL_TO_BOOL(_v_table->seek(_user_data, offset));
-    }
+  file->Seek(0, eFileSeekOrigin_Start);
+  const AmSize read = file->Read(header, g_probe_header_size);
+  file->Seek(static_cast<AmInt64>(position), eFileSeekOrigin_Start);
 
-  public:
-    am_codec_decoder_vtable *_v_table;
-    am_voidptr _user_data;
-  };
-
-  class CEncoder final : public Encoder {
-  public:
-    explicit CEncoder(const Codec *codec, am_codec_encoder_vtable *v_table,
-                      am_voidptr user_data = nullptr)
-        : Encoder(codec), _v_table(v_table), _user_data(user_data) {
-      if (_v_table && _v_table->create)
-        _v_table->create(_user_data);
-    }
+  for (const auto &signature : g_probe_signatures) {
+    const AmSize end = signature.offset + signature.magic.size();
+    if (end > read)
+      continue;
 
-    ~CEncoder() override {
-      if (_v_table && _v_table->destroy)
-        _v_table->destroy(_user_data);
+    if (std::memcmp(header + signature.offset, signature.magic.data(),
+                    signature.magic.size()) != 0)
+      continue;
 
-      _v_table = nullptr;
-      _user_data = nullptr;
-    }
+    if (auto codec = Codec::Find(signature.codec))
+      return codec;
+  }
 
-    bool Open(std::shared_ptr<File> file) override {
-      if (!_v_table || !_v_table->open || !file)
-        return false;
+  return nullptr;
+}
 
-      am_file_handle handle = {am_file_type_unknown, file.get()};
-      return AM_BOOL_TO_BOOL(_v_table->open(_user_data, handle));
-    }
+// Smallest number of decoders streamed by a single pool task
+static constexpr am_size kMinStreamsPerTask = 16;
 
-    bool Close() override {
-      if (!_v_table || !_v_table->close)
-        return false;
+static bool
+has_duplicate_decoders(const std::shared_ptr<Codec::Decoder> *decoders,
+                       am_size count) {
+  // Reused between calls so that refilling voices does not allocate
+  thread_local std::vector<const Codec::Decoder *> sorted;
+  sorted.resize(count);
+  for (am_size i = 0; i < count; ++i)
+    sorted[i] = decoders[i].get();
 
-      return AM_BOOL_TO_BOOL(_v_table->close(_user_data));
-    }
+  std::sort(sorted.begin(), sorted.end());
 
-    void SetFormat(const SoundFormat &format) override {
-      Encoder::SetFormat(format);
+  // Invalid handles are skipped by the streaming, so they may repeat
+  const auto first = std::find_if(sorted.begin(), sorted.end(),
+                                  [](const auto *decoder) { return decoder; });
+  return std::adjacent_find(first, sorted.end()) != sorted.end();
+}
 
-      if (_v_table && _v_table->set_format) {
-        am_sound_format c_format = from_cpp_sound_format(format);
-        _v_table->set_format(_user_data, &c_format);
+/**
+ * @brief Arguments of a batched decoder stream call.
+ */
+struct StreamBatch {
+  const std::shared_ptr<Codec::Decoder> *decoders;
+  const am_voidptr *outs;
+  const am_uint64 *buffer_offsets;
+  const am_uint64 *seek_offsets;
+  const am_uint64 *lengths;
+  am_uint64 *results;
+
+  void Run(am_size begin, am_size end) const {
+    for (am_size i = begin; i < end; ++i) {
+      auto *decoder = dynamic_cast<CCodec::CDecoder *>(decoders[i].get());
+      if (!decoder || !outs[i]) {
+        results[i] = 0;
+        continue;
       }
-    }
-
-    AmUInt64 Write(AudioBuffer *in, AmUInt64 offset, AmUInt64 length) override {
-      if (!_v_table || !_v_table->write || !in)
-        return 0;
 
-      return _v_table->write(_user_data, in->GetData().GetBuffer(), offset,
-                             length);
+      results[i] = decoder->StreamRaw(
+          outs[i], buffer_offsets ? buffer_offsets[i] : 0, seek_offsets[i],
+          lengths[i]);
     }
-
-  public:
-    am_codec_encoder_vtable *_v_table;
-    am_voidptr _user_data;
-  };
-
-  explicit CCodec(const am_codec_config &config)
-      : Codec(config.name), _config(config) {
-    if (_config.v_table && _config.v_table->on_register)
-      _config.v_table->on_register(_config.user_data);
-  }
-
-  ~CCodec() override {
-    if (_config.v_table && _config.v_table->on_unregister)
-      _config.v_table->on_unregister(_config.user_data);
   }
+};
 
-  std::shared_ptr<Decoder> CreateDecoder() override {
-    if (!_config.decoder.v_table)
-      return nullptr;
+class StreamBatchTask final : public Thread::AwaitablePoolTask {
+public:
+  StreamBatchTask(const StreamBatch *batch, am_size begin, am_size end)
+      : _batch(batch), _begin(begin), _end(end) {}
 
-    return ampoolshared(eMemoryPoolKind_Codec, CDecoder, this,
-                        _config.decoder.v_table, _config.decoder.user_data);
-  }
+  void AwaitableWork() override { _batch->Run(_begin, _end); }
 
-  std::shared_ptr<Encoder> CreateEncoder() override {
-    if (!_config.encoder.v_table)
-      return nullptr;
+private:
+  const StreamBatch *_batch;
+  am_size _begin;
+  am_size _end;
+};
 
-    return ampoolshared(eMemoryPoolKind_Codec, CEncoder, this,
-                        _config.encoder.v_table, _config.encoder.user_data);
-  }
+extern "C" {
 
-  [[nodiscard]] bool CanHandleFile(std::shared_ptr<File> file) const override {
-    if (!_config.v_table || !_config.v_table->on_can_handle_file || !file)
-      return false;
+am_codec_decoder_vtable am_codec_decoder_vtable_init(void) {
+  AM_STATS_SCOPE(codec);
+  am_codec_decoder_vtable v_table = {};
+  return v_table;
+}
 
-    am_file_handle handle = {am_file_type_unknown, file.get()};
-    return AM_BOOL_TO_BOOL(
-        _config.v_table->on_can_handle_file(_config.user_data, handle));
-  }
+am_codec_decoder_ext_vtable am_codec_decoder_ext_vtable_init(void) {
+  AM_STATS_SCOPE(codec);
+  am_codec_decoder_ext_vtable v_table = {};
 
-private:
-  am_codec_config _config;
-};
+  v_table.struct_size = sizeof(am_codec_decoder_ext_vtable);
 
-extern "C" {
+  return v_table;
+}
 
 am_codec_config am_codec_config_init(const char *name) {
+  AM_STATS_SCOPE(codec);
   am_codec_config config;
 
   config.name = name;
@@ -242,27 +214,45 @@ am_codec_config am_codec_config_init(const char *name) {
   config.decoder.user_data = nullptr;
   config.encoder.v_table = nullptr;
   config.encoder.user_data = nullptr;
+  config.decoder_ext_v_table = nullptr;
 
   return config;
 }
 
 void am_codec_register(const am_codec_config *config) {
+  AM_STATS_SCOPE(codec);
   if (!config)
     return;
 
   Codec::Register(ampoolshared(eMemoryPoolKind_Codec, CCodec, *config));
+
+  // Paths probed before may belong to the new codec
+  clear_probe_cache();
 }
 
 void am_codec_unregister(const char *name) {
+  AM_STATS_SCOPE(codec);
   if (!name)
     return;
 
   auto codec = Codec::Find(name);
   if (codec)
     Codec::Unregister(codec);
+
+  std::lock_guard lock(g_probe_cache_mutex);
+  for (auto it = g_probe_cache.begin(); it != g_probe_cache.end();) {
+    if (it->second.codec != name) {
+      ++it;
+      continue;
+    }
+
+    g_probe_cache_lru.erase(it->second.lru);
+    it = g_probe_cache.erase(it);
+  }
 }
 
 am_codec_handle am_codec_find(const char *name) {
+  AM_STATS_SCOPE(codec);
   if (!name)
     return nullptr;
 
@@ -271,17 +261,93 @@ am_codec_handle am_codec_find(const char *name) {
 }
 
 am_codec_handle am_codec_find_for_file(am_file_handle file) {
+  AM_STATS_SCOPE(codec);
   if (!file.handle)
     return nullptr;
 
   auto file_ptr = static_cast<File *>(file.handle);
-  auto shared_file =
-      std::shared_ptr<File>(file_ptr, [](File *) {}); // Non-owning shared_ptr
-  auto codec = Codec::FindForFile(shared_file);
+  const AmOsString path = file_ptr->GetPath();
+
+  if (AmString cached; !path.empty() && find_cached_probe(path, cached)) {
+    if (auto codec = Codec::Find(cached))
+      return reinterpret_cast<am_codec_handle>(codec.get());
+  }
+
+  auto codec = find_codec_by_signature(file_ptr);
+
+  if (!codec) {
+    auto shared_file = std::shared_ptr<File>(
+        file_ptr, [](File *) {}); // Non-owning shared_ptr
+    codec = Codec::FindForFile(shared_file);
+  }
+
+  if (codec && !path.empty())
+    cache_probe(path, codec->GetName());
+
   return reinterpret_cast<am_codec_handle>(codec.get());
 }
 
+am_bool am_codec_register_signature(const char *codec_name,
+                                    const am_uint8 *magic, am_size length,
+                                    am_size offset) {
+  AM_STATS_SCOPE(codec);
+  if (!codec_name || !magic || length == 0 ||
+      offset + length > kMaxCodecSignatureEnd)
+    return AM_FALSE;
+
+  std::unique_lock lock(g_probe_mutex);
+
+  CodecSignature signature = {codec_name,
+                              std::vector<AmUInt8>(magic, magic + length),
+                              offset};
+
+  // Keep the longest signatures first so the most specific ones win
+  const auto it = std::find_if(
+      g_probe_signatures.begin(), g_probe_signatures.end(),
+      [length](const auto &s) { return s.magic.size() < length; });
+  g_probe_signatures.insert(it, std::move(signature));
+
+  g_probe_header_size = std::max<AmSize>(g_probe_header_size, offset + length);
+
+  // A more specific signature may now match paths probed before
+  clear_probe_cache();
+  return AM_TRUE;
+}
+
+void am_codec_unregister_signatures(const char *codec_name) {
+  AM_STATS_SCOPE(codec);
+  if (!codec_name)
+    return;
+
+  std::unique_lock lock(g_probe_mutex);
+
+  std::erase_if(g_probe_signatures, [codec_name](const auto &signature) {
+    return signature.codec == codec_name;
+  });
+
+  g_probe_header_size = 0;
+  for (const auto &signature : g_probe_signatures)
+    g_probe_header_size = std::max<AmSize>(
+        g_probe_header_size, signature.offset + signature.magic.size());
+
+  clear_probe_cache();
+}
+
+void am_codec_probe_cache_clear() {
+  AM_STATS_SCOPE(codec);
+  clear_probe_cache();
+}
+
+void am_codec_probe_cache_set_capacity(am_size count) {
+  AM_STATS_SCOPE(codec);
+  std::lock_guard lock(g_probe_cache_mutex);
+
+  g_probe_cache_capacity = count;
+  evict_probe_cache();
+}
+
 am_bool am_codec_can_handle_file(am_codec_handle codec, am_file_handle file) {
+  AM_STATS_SCOPE(codec);
   if (!codec || !file.handle)
     return AM_FALSE;
 
@@ -292,7 +358,30 @@ am_bool am_codec_can_handle_file(am_codec_handle codec, am_file_handle file) {
       reinterpret_cast<Codec *>(codec)->CanHandleFile(shared_file));
 }
 
+void am_codec_set_decoder_pool_size(am_codec_handle codec, am_uint32 size) {
+  AM_STATS_SCOPE(codec);
+  if (!codec)
+    return;
+
+  auto c_codec = dynamic_cast<CCodec *>(reinterpret_cast<Codec *>(codec));
+  if (c_codec)
+    c_codec->SetDecoderPoolSize(size);
+}
+
+am_uint32 am_codec_get_decoder_pool_count(am_codec_handle codec) {
+  AM_STATS_SCOPE(codec);
+  if (!codec)
+    return 0;
+
+  auto c_codec = dynamic_cast<CCodec *>(reinterpret_cast<Codec *>(codec));
+  if (!c_codec)
+    return 0;
+
+  return static_cast<am_uint32>(c_codec->GetDecoderPoolCount());
+}
+
 const char *am_codec_get_name(am_codec_handle codec) {
+  AM_STATS_SCOPE(codec);
   if (!codec)
     return nullptr;
 
@@ -303,6 +392,7 @@ const char *am_codec_get_name(am_codec_handle codec) {
 // Decoder functions
 
 am_codec_decoder_handle am_codec_decoder_create(const char *codec_name) {
+  AM_STATS_SCOPE(codec);
   if (!codec_name)
     return nullptr;
 
@@ -320,6 +410,7 @@ am_codec_decoder_handle am_codec_decoder_create(const char *codec_name) {
 
 am_codec_decoder_handle
 am_codec_decoder_create_from_codec(am_codec_handle codec) {
+  AM_STATS_SCOPE(codec);
   if (!codec)
     return nullptr;
 
@@ -332,6 +423,7 @@ am_codec_decoder_create_from_codec(am_codec_handle codec) {
 }
 
 void am_codec_decoder_destroy(am_codec_decoder_handle handle) {
+  AM_STATS_SCOPE(codec);
   if (!handle)
     return;
 
@@ -340,6 +432,9 @@ void am_codec_decoder_destroy(am_codec_decoder_handle handle) {
 
 am_bool am_codec_decoder_open(am_codec_decoder_handle handle,
                               am_file_handle file) {
+  AM_STATS_SCOPE(codec);
+  AM_TRACE_SCOPE("codec.open");
+
   if (!handle || !file.handle)
     return AM_FALSE;
 
@@ -354,6 +449,7 @@ am_bool am_codec_decoder_open(am_codec_decoder_handle handle,
 }
 
 am_bool am_codec_decoder_close(am_codec_decoder_handle handle) {
+  AM_STATS_SCOPE(codec);
   if (!handle)
     return AM_FALSE;
 
@@ -366,6 +462,7 @@ am_bool am_codec_decoder_close(am_codec_decoder_handle handle) {
 
 am_bool am_codec_decoder_get_format(am_codec_decoder_handle handle,
                                     am_sound_format *format) {
+  AM_STATS_SCOPE(codec);
   if (!handle || !format)
     return AM_FALSE;
 
@@ -373,12 +470,35 @@ am_bool am_codec_decoder_get_format(am_codec_decoder_handle handle,
   if (!decoder)
     return AM_FALSE;
 
-  *format = from_cpp_sound_format(decoder->GetFormat());
+  // Decoders of the engine codecs do not convert their output
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  *format = from_cpp_sound_format(c_decoder ? c_decoder->GetOutputFormat()
+                                            : decoder->GetFormat());
   return AM_TRUE;
 }
 
+am_bool am_codec_decoder_set_output_format(am_codec_decoder_handle handle,
+                                           am_audio_sample_format format) {
+  AM_STATS_SCOPE(codec);
+  if (!handle)
+    return AM_FALSE;
+
+  auto decoder = GET_SHARED_PTR(Codec::Decoder, handle);
+  if (!decoder)
+    return AM_FALSE;
+
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return AM_FALSE;
+
+  return BOOL_TO_AM_BOOL(c_decoder->SetOutputFormat(format));
+}
+
 am_uint64 am_codec_decoder_load(am_codec_decoder_handle handle,
                                 am_voidptr out) {
+  AM_STATS_SCOPE(codec);
+  AM_TRACE_SCOPE("codec.load");
+
   if (!handle || !out)
     return 0;
 
@@ -389,17 +509,39 @@ am_uint64 am_codec_decoder_load(am_codec_decoder_handle handle,
   // For raw buffer operations, we need to pass the buffer directly to the C
   // callback The AudioBuffer approach doesn't work with external raw buffers,
   // so we bypass it
-  auto c_decoder = static_cast<CCodec::CDecoder *>(decoder.get());
-  if (c_decoder && c_decoder->_v_table && c_decoder->_v_table->load) {
-    return c_decoder->_v_table->load(c_decoder->_user_data, out);
-  }
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder || !c_decoder->CanLoad())
+    return 0;
 
-  return 0;
+  auto &cache = DecodedSoundCache::Instance();
+  if (c_decoder->GetPath().empty() || !cache.IsEnabled())
+    return c_decoder->LoadRaw(out);
+
+  const auto format = c_decoder->GetOutputFormat();
+  const DecodedSoundCache::Key key = {c_decoder->GetPath(),
+                                      c_decoder->GetCodecName(),
+                                      format.GetSampleRate(),
+                                      format.GetNumChannels(),
+                                      format.GetBitsPerSample(),
+                                      format.GetSampleType()};
+
+  AmUInt64 frames = 0;
+  if (cache.Fetch(key, out, frames))
+    return frames;
+
+  frames = c_decoder->LoadRaw(out);
+  if (frames > 0)
+    cache.Insert(key, out, frames * get_frame_size(format), frames);
+
+  return frames;
 }
 
 am_uint64 am_codec_decoder_stream(am_codec_decoder_handle handle,
                                   am_voidptr out, am_uint64 buffer_offset,
                                   am_uint64 seek_offset, am_uint64 length) {
+  AM_STATS_SCOPE(codec);
+  AM_TRACE_SCOPE("codec.stream");
+
   if (!handle || !out)
     return 0;
 
@@ -409,17 +551,78 @@ am_uint64 am_codec_decoder_stream(am_codec_decoder_handle handle,
 
   // For raw buffer operations, we need to pass the buffer directly to the C
   // callback
-  auto c_decoder = static_cast<CCodec::CDecoder *>(decoder.get());
-  if (c_decoder && c_decoder->_v_table && c_decoder->_v_table->stream) {
-    return c_decoder->_v_table->stream(c_decoder->_user_data, out,
-                                       buffer_offset, seek_offset, length);
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return 0;
+
+  return c_decoder->StreamRaw(out, buffer_offset, seek_offset, length);
+}
+
+void am_codec_decoder_stream_many(const am_codec_decoder_handle *handles,
+                                  const am_voidptr *outs,
+                                  const am_uint64 *buffer_offsets,
+                                  const am_uint64 *seek_offsets,
+                                  const am_uint64 *lengths,
+                                  am_uint64 *results, am_size count,
+                                  am_thread_pool_handle pool) {
+  AM_STATS_SCOPE(codec);
+  AM_TRACE_SCOPE("codec.stream_many");
+
+  if (!handles || !outs || !seek_offsets || !lengths || !results ||
+      count == 0)
+    return;
+
+  // Reused between calls so that refilling voices does not allocate
+  thread_local std::vector<std::shared_ptr<Codec::Decoder>> decoders;
+  decoders.resize(count);
+
+  GET_MANY_SHARED_PTR(Codec::Decoder, handles, decoders.data(), count);
+
+  const StreamBatch batch = {decoders.data(), outs,    buffer_offsets,
+                             seek_offsets,    lengths, results};
+
+  auto *thread_pool = reinterpret_cast<Thread::Pool *>(pool);
+  am_size tasks_count =
+      thread_pool ? std::min<am_size>(thread_pool->GetThreadCount() + 1,
+                                      count / kMinStreamsPerTask)
+                  : 1;
+
+  // Two tasks must never stream the same decoder at once
+  if (tasks_count > 1 && has_duplicate_decoders(decoders.data(), count))
+    tasks_count = 1;
+
+  if (tasks_count <= 1) {
+    batch.Run(0, count);
+  } else {
+    // The calling thread streams the first range while the pool handles the
+    // others
+    const am_size range = (count + tasks_count - 1) / tasks_count;
+
+    std::vector<std::shared_ptr<StreamBatchTask>> tasks;
+    tasks.reserve(tasks_count - 1);
+
+    for (am_size begin = range; begin < count; begin += range) {
+      auto task =
+          ampoolshared(eMemoryPoolKind_Codec, StreamBatchTask, &batch, begin,
+                       std::min(begin + range, count));
+      thread_pool->AddTask(task);
+      tasks.push_back(std::move(task));
+    }
+
+    batch.Run(0, std::min(range, count));
+
+    for (const auto &task : tasks)
+      task->Await();
   }
 
-  return 0;
+  // Do not keep the decoders alive until the next call
+  for (auto &decoder : decoders)
+    decoder.reset();
 }
 
 am_bool am_codec_decoder_seek(am_codec_decoder_handle handle,
                               am_uint64 offset) {
+  AM_STATS_SCOPE(codec);
   if (!handle)
     return AM_FALSE;
 
@@ -430,9 +633,86 @@ am_bool am_codec_decoder_seek(am_codec_decoder_handle handle,
   return BOOL_TO_AM_BOOL(decoder->Seek(offset));
 }
 
+// Seek table functions
+
+am_bool am_codec_decoder_save_seek_table(am_codec_decoder_handle handle,
+                                         am_file_handle file) {
+  AM_STATS_SCOPE(codec);
+  if (!handle || !file.handle)
+    return AM_FALSE;
+
+  auto decoder = GET_SHARED_PTR(Codec::Decoder, handle);
+  if (!decoder)
+    return AM_FALSE;
+
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return AM_FALSE;
+
+  const auto &table = c_decoder->GetSeekTable();
+  if (!table)
+    return AM_FALSE;
+
+  return BOOL_TO_AM_BOOL(table->Save(static_cast<File *>(file.handle)));
+}
+
+am_bool am_codec_decoder_load_seek_table(am_codec_decoder_handle handle,
+                                         am_file_handle file) {
+  AM_STATS_SCOPE(codec);
+  if (!handle || !file.handle)
+    return AM_FALSE;
+
+  auto decoder = GET_SHARED_PTR(Codec::Decoder, handle);
+  if (!decoder)
+    return AM_FALSE;
+
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return AM_FALSE;
+
+  const auto &table = c_decoder->GetSeekTable();
+  if (!table)
+    return AM_FALSE;
+
+  return BOOL_TO_AM_BOOL(table->Load(static_cast<File *>(file.handle)));
+}
+
+am_uint64 am_codec_decoder_get_seek_table_size(am_codec_decoder_handle handle) {
+  AM_STATS_SCOPE(codec);
+  if (!handle)
+    return 0;
+
+  auto decoder = GET_SHARED_PTR(Codec::Decoder, handle);
+  if (!decoder)
+    return 0;
+
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return 0;
+
+  const auto &table = c_decoder->GetSeekTable();
+  return table ? table->GetCount() : 0;
+}
+
+void am_codec_seek_table_set_interval(am_uint64 frames) {
+  AM_STATS_SCOPE(codec);
+  SeekTable::SetInterval(frames);
+}
+
+void am_codec_seek_tables_clear(void) {
+  AM_STATS_SCOPE(codec);
+  SeekTable::ClearAll();
+}
+
+void am_codec_seek_tables_set_capacity(am_size count) {
+  AM_STATS_SCOPE(codec);
+  SeekTable::SetCapacity(count);
+}
+
 // Encoder functions
 
 am_codec_encoder_handle am_codec_encoder_create(const char *codec_name) {
+  AM_STATS_SCOPE(codec);
   if (!codec_name)
     return nullptr;
 
@@ -450,6 +730,7 @@ am_codec_encoder_handle am_codec_encoder_create(const char *codec_name) {
 
 am_codec_encoder_handle
 am_codec_encoder_create_from_codec(am_codec_handle codec) {
+  AM_STATS_SCOPE(codec);
   if (!codec)
     return nullptr;
 
@@ -462,6 +743,7 @@ am_codec_encoder_create_from_codec(am_codec_handle codec) {
 }
 
 void am_codec_encoder_destroy(am_codec_encoder_handle handle) {
+  AM_STATS_SCOPE(codec);
   if (!handle)
     return;
 
@@ -470,6 +752,7 @@ void am_codec_encoder_destroy(am_codec_encoder_handle handle) {
 
 am_bool am_codec_encoder_open(am_codec_encoder_handle handle,
                               am_file_handle file) {
+  AM_STATS_SCOPE(codec);
   if (!handle || !file.handle)
     return AM_FALSE;
 
@@ -484,6 +767,7 @@ am_bool am_codec_encoder_open(am_codec_encoder_handle handle,
 }
 
 am_bool am_codec_encoder_close(am_codec_encoder_handle handle) {
+  AM_STATS_SCOPE(codec);
   if (!handle)
     return AM_FALSE;
 
@@ -496,6 +780,7 @@ am_bool am_codec_encoder_close(am_codec_encoder_handle handle) {
 
 void am_codec_encoder_set_format(am_codec_encoder_handle handle,
                                  const am_sound_format *format) {
+  AM_STATS_SCOPE(codec);
   if (!handle || !format)
     return;
 
@@ -509,6 +794,7 @@ void am_codec_encoder_set_format(am_codec_encoder_handle handle,
 
 am_uint64 am_codec_encoder_write(am_codec_encoder_handle handle, am_voidptr in,
                                  am_uint64 offset, am_uint64 length) {
+  AM_STATS_SCOPE(codec);
   if (!handle || !in)
     return 0;
 
@@ -518,7 +804,7 @@ am_uint64 am_codec_encoder_write(am_codec_encoder_handle handle, am_voidptr in,
 
   // For raw buffer operations, we need to pass the buffer directly to the C
   // callback
-  auto c_encoder = static_cast<CCodec::CEncoder *>(encoder.get());
+  auto c_encoder = dynamic_cast<CCodec::CEncoder *>(encoder.get());
   if (c_encoder && c_encoder->_v_table && c_encoder->_v_table->write) {
     return c_encoder->_v_table->write(c_encoder->_user_data, in, offset,
                                       length);
@@ -527,9 +813,63 @@ am_uint64 am_codec_encoder_write(am_codec_encoder_handle handle, am_voidptr in,
   return 0;
 }
 
+// Cache functions
+
+void am_codec_cache_set_capacity(am_size capacity) {
+  AM_STATS_SCOPE(codec);
+  DecodedSoundCache::Instance().SetCapacity(capacity);
+}
+
+am_size am_codec_cache_get_capacity() {
+  AM_STATS_SCOPE(codec);
+  return DecodedSoundCache::Instance().GetStats().capacity;
+}
+
+void am_codec_cache_pin(const am_oschar *path, const char *codec_name) {
+  AM_STATS_SCOPE(codec);
+  if (!path || !codec_name)
+    return;
+
+  DecodedSoundCache::Instance().Pin(path, codec_name);
+}
+
+void am_codec_cache_unpin(const am_oschar *path, const char *codec_name) {
+  AM_STATS_SCOPE(codec);
+  if (!path || !codec_name)
+    return;
+
+  DecodedSoundCache::Instance().Unpin(path, codec_name);
+}
+
+void am_codec_cache_clear() {
+  AM_STATS_SCOPE(codec);
+  DecodedSoundCache::Instance().Clear();
+}
+
+am_bool am_codec_cache_get_stats(am_codec_cache_stats *stats) {
+  AM_STATS_SCOPE(codec);
+  if (!stats)
+    return AM_FALSE;
+
+  const auto result = DecodedSoundCache::Instance().GetStats();
+  stats->hits = result.hits;
+  stats->misses = result.misses;
+  stats->evictions = result.evictions;
+  stats->used_bytes = result.used_bytes;
+  stats->capacity = result.capacity;
+  stats->entries = result.entries;
+  return AM_TRUE;
+}
+
+void am_codec_cache_reset_stats() {
+  AM_STATS_SCOPE(codec);
+  DecodedSoundCache::Instance().ResetStats();
+}
+
 // Utility functions
 
 am_sound_format am_sound_format_init(void) {
+  AM_STATS_SCOPE(codec);
   am_sound_format format;
   format.sample_rate = 44100;
   format.num_channels = 2;
@@ -544,6 +884,7 @@ void am_sound_format_set_all(am_sound_format *format, am_uint32 sample_rate,
                              am_uint16 num_channels, am_uint32 bits_per_sample,
                              am_uint64 frames_count, am_uint32 frame_size,
                              am_audio_sample_format sample_type) {
+  AM_STATS_SCOPE(codec);
   if (!format)
     return;
 
@@ -0,0 +1,295 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_codec_internals.h"
+#include "amplitude_ring_buffer.h"
+#include "amplitude_stats.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+class EncoderStream final : public std::enable_shared_from_this<EncoderStream> {
+public:
+  EncoderStream(std::shared_ptr<CCodec::CEncoder> encoder,
+                const am_codec_encoder_stream_config &config)
+      : _encoder(std::move(encoder)), _config(config),
+        _ring(eMemoryPoolKind_Codec, config.capacity,
+              get_frame_size(_encoder->GetFormat())) {
+    if (_config.chunk_size == 0 || _config.chunk_size > _config.capacity)
+      _config.chunk_size = _config.capacity;
+  }
+
+  [[nodiscard]] bool IsValid() const {
+    return _ring.IsValid() && _encoder->_v_table && _encoder->_v_table->write;
+  }
+
+  AmUInt64 Write(const void *src, AmUInt64 frames) {
+    // Never wait for the encoder: the caller sees the backpressure through
+    // the number of frames accepted
+    const AmUInt64 written = _ring.Write(src, frames);
+
+    _rejected.fetch_add(frames - written, std::memory_order_relaxed);
+
+    // Without a pool, the owner drains the stream from its own thread
+    if (_config.pool && _ring.GetReadAvailable() >= _config.chunk_size)
+      RequestDrain();
+
+    return written;
+  }
+
+  AmUInt64 Drain(bool all) {
+    bool expected = false;
+    if (!_draining.compare_exchange_strong(expected, true,
+                                           std::memory_order_acquire))
+      return 0; // Another drain is in progress
+
+    bool refused = false;
+    const AmUInt64 total = DrainLocked(all, refused);
+
+    _draining.store(false, std::memory_order_release);
+
+    // Frames written while the draining flag was held may have had their
+    // request rejected. Refused frames wait for the next write instead, so
+    // that a stuck encoder does not keep the pool busy.
+    if (_config.pool && !refused &&
+        _ring.GetReadAvailable() >= _config.chunk_size)
+      RequestDrain();
+
+    return total;
+  }
+
+  AmUInt64 Flush() {
+    // Wait for any in-flight drain to release the consumer side
+    bool expected = false;
+    while (!_draining.compare_exchange_weak(expected, true,
+                                            std::memory_order_acquire)) {
+      expected = false;
+      std::this_thread::yield();
+    }
+
+    bool refused = false;
+    const AmUInt64 total = DrainLocked(true, refused);
+
+    _draining.store(false, std::memory_order_release);
+    return total;
+  }
+
+  void Close() { _closing.store(true, std::memory_order_relaxed); }
+
+  [[nodiscard]] AmUInt64 GetFree() const { return _ring.GetWriteAvailable(); }
+
+  [[nodiscard]] AmUInt64 GetPending() const {
+    return _ring.GetReadAvailable();
+  }
+
+  [[nodiscard]] AmUInt64 GetEncoded() const {
+    return _encoded.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] AmUInt64 GetRejected() const {
+    return _rejected.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool HasFailed() const {
+    return _failed.load(std::memory_order_relaxed);
+  }
+
+private:
+  class DrainTask final : public Thread::PoolTask {
+  public:
+    explicit DrainTask(std::shared_ptr<EncoderStream> stream)
+        : _stream(std::move(stream)) {}
+
+    void Work() override {
+      _stream->_drain_pending.store(false, std::memory_order_release);
+      _stream->Drain(false);
+    }
+
+    bool Ready() override { return true; }
+
+  private:
+    std::shared_ptr<EncoderStream> _stream;
+  };
+
+  AmUInt64 DrainLocked(bool all, bool &refused) {
+    AmUInt64 total = 0;
+
+    while (!_closing.load(std::memory_order_relaxed) || all) {
+      const AmUInt64 available = _ring.GetReadAvailable();
+      if (available == 0 || (!all && available < _config.chunk_size))
+        break;
+
+      const AmUInt64 length = std::min<AmUInt64>(
+          _ring.GetContiguousReadAvailable(), _config.chunk_size);
+
+      const AmUInt64 written = _encoder->_v_table->write(
+          _encoder->_user_data, _ring.GetData(), _ring.GetReadIndex(), length);
+
+      _ring.CommitRead(written);
+      _encoded.fetch_add(written, std::memory_order_relaxed);
+      total += written;
+
+      // The encoder cannot keep up or failed. Keep what it refused for the
+      // next drain, the writer sees the backpressure once the buffer is full.
+      refused = written < length;
+      _failed.store(refused, std::memory_order_relaxed);
+
+      if (refused)
+        break;
+    }
+
+    return total;
+  }
+
+  void RequestDrain() {
+    if (_closing.load(std::memory_order_relaxed))
+      return;
+
+    if (_drain_pending.exchange(true, std::memory_order_acq_rel))
+      return; // A drain is already scheduled
+
+    reinterpret_cast<Thread::Pool *>(_config.pool)
+        ->AddTask(ampoolshared(eMemoryPoolKind_Codec, DrainTask,
+                               shared_from_this()));
+  }
+
+  std::shared_ptr<CCodec::CEncoder> _encoder;
+  am_codec_encoder_stream_config _config;
+
+  SpscRingBuffer _ring;
+
+  std::atomic<bool> _draining = false;
+  std::atomic<bool> _drain_pending = false;
+  std::atomic<bool> _closing = false;
+  std::atomic<bool> _failed = false;
+
+  std::atomic<AmUInt64> _encoded = 0;
+  std::atomic<AmUInt64> _rejected = 0;
+};
+
+extern "C" {
+
+am_codec_encoder_stream_config am_codec_encoder_stream_config_init(void) {
+  AM_STATS_SCOPE(codec);
+  am_codec_encoder_stream_config config;
+
+  config.capacity = 16384;
+  config.chunk_size = 4096;
+  config.pool = nullptr;
+
+  return config;
+}
+
+am_codec_encoder_stream_handle
+am_codec_encoder_stream_create(am_codec_encoder_handle encoder,
+                               const am_codec_encoder_stream_config *config) {
+  AM_STATS_SCOPE(codec);
+  if (!encoder || !config || config->capacity == 0)
+    return nullptr;
+
+  auto encoder_ptr = GET_SHARED_PTR(Codec::Encoder, encoder);
+  if (!encoder_ptr)
+    return nullptr;
+
+  auto c_encoder = std::dynamic_pointer_cast<CCodec::CEncoder>(encoder_ptr);
+  if (!c_encoder || get_frame_size(c_encoder->GetFormat()) == 0)
+    return nullptr;
+
+  auto stream =
+      ampoolshared(eMemoryPoolKind_Codec, EncoderStream, c_encoder, *config);
+  if (!stream->IsValid())
+    return nullptr;
+
+  return reinterpret_cast<am_codec_encoder_stream_handle>(
+      STORE_SHARED_PTR(EncoderStream, stream));
+}
+
+void am_codec_encoder_stream_destroy(am_codec_encoder_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return;
+
+  auto stream_ptr = GET_SHARED_PTR(EncoderStream, stream);
+  if (!stream_ptr)
+    return;
+
+  stream_ptr->Flush();
+  stream_ptr->Close();
+  REMOVE_SHARED_PTR(EncoderStream, stream);
+}
+
+am_uint64 am_codec_encoder_stream_write(am_codec_encoder_stream_handle stream,
+                                        const void *src, am_uint64 frames) {
+  AM_STATS_SCOPE(codec);
+  if (!stream || !src)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(EncoderStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->Write(src, frames);
+}
+
+am_uint64 am_codec_encoder_stream_drain(am_codec_encoder_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(EncoderStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->Drain(false);
+}
+
+am_uint64 am_codec_encoder_stream_flush(am_codec_encoder_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(EncoderStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->Flush();
+}
+
+am_bool am_codec_encoder_stream_get_stats(
+    am_codec_encoder_stream_handle stream,
+    am_codec_encoder_stream_stats *stats) {
+  AM_STATS_SCOPE(codec);
+  if (!stream || !stats)
+    return AM_FALSE;
+
+  auto stream_ptr = GET_SHARED_PTR(EncoderStream, stream);
+  if (!stream_ptr)
+    return AM_FALSE;
+
+  stats->free = stream_ptr->GetFree();
+  stats->pending = stream_ptr->GetPending();
+  stats->encoded = stream_ptr->GetEncoded();
+  stats->rejected = stream_ptr->GetRejected();
+  stats->failed = BOOL_TO_AM_BOOL(stream_ptr->HasFailed());
+
+  return AM_TRUE;
+}
+
+} // extern "C"
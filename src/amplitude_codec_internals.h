@@ -0,0 +1,740 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_CODEC_INTERNALS_H
+#define _AM_IMPLEMENTATION_CODEC_INTERNALS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_internals.h"
+#include "amplitude_sample_conversion.h"
+#include "amplitude_seek_table.h"
+
+// Helper functions for format conversion
+inline eAudioSampleFormat
+to_cpp_sample_format(am_audio_sample_format format)
+{
+    switch (format)
+    {
+    case am_audio_sample_format_float32:
+        return eAudioSampleFormat_Float32;
+    case am_audio_sample_format_int16:
+        return eAudioSampleFormat_Int16;
+    case am_audio_sample_format_unknown:
+    default:
+        return eAudioSampleFormat_Unknown;
+    }
+}
+
+inline am_audio_sample_format
+from_cpp_sample_format(eAudioSampleFormat format)
+{
+    switch (format)
+    {
+    case eAudioSampleFormat_Float32:
+        return am_audio_sample_format_float32;
+    case eAudioSampleFormat_Int16:
+        return am_audio_sample_format_int16;
+    case eAudioSampleFormat_Unknown:
+    default:
+        return am_audio_sample_format_unknown;
+    }
+}
+
+inline SoundFormat
+to_cpp_sound_format(const am_sound_format& format)
+{
+    SoundFormat result;
+    result.SetAll(
+        format.sample_rate, format.num_channels, format.bits_per_sample, format.frames_count, format.frame_size,
+        to_cpp_sample_format(format.sample_type));
+    return result;
+}
+
+inline am_sound_format
+from_cpp_sound_format(const SoundFormat& format)
+{
+    am_sound_format result;
+    result.sample_rate = format.GetSampleRate();
+    result.num_channels = format.GetNumChannels();
+    result.bits_per_sample = format.GetBitsPerSample();
+    result.frames_count = format.GetFramesCount();
+    result.frame_size = format.GetFrameSize();
+    result.sample_type = from_cpp_sample_format(format.GetSampleType());
+    return result;
+}
+
+/**
+ * @brief Gets the size in bytes of a single frame of the given format.
+ *
+ * Falls back to computing the size from the channel count and the bits per sample
+ * when the decoder did not fill the frame size.
+ */
+inline AmSize
+get_frame_size(const SoundFormat& format)
+{
+    if (format.GetFrameSize() > 0)
+        return format.GetFrameSize();
+
+    return static_cast<AmSize>(format.GetNumChannels()) * (format.GetBitsPerSample() / 8);
+}
+
+/**
+ * @brief Codec implementation forwarding all the calls to a C virtual table.
+ */
+class CCodec final : public Codec
+{
+public:
+    /**
+     * @brief Decoder functions copied from the C tables at registration.
+     *
+     * Shared by the codec and all its decoders, so that decoders still alive after the
+     * codec was unregistered never call through a released table.
+     */
+    struct DecoderVTable : am_codec_decoder_vtable
+    {
+        am_bool (*reset)(am_voidptr user_data) = nullptr;
+        am_bool (*seek_to_checkpoint)(
+            am_voidptr user_data, am_uint64 frame, am_uint64 checkpoint_frame, am_uint64 checkpoint_offset) = nullptr;
+        am_bool (*get_checkpoint)(am_voidptr user_data, am_uint64* frame, am_uint64* offset) = nullptr;
+    };
+
+    /**
+     * @brief Decoder exposed to the C API.
+     *
+     * The sample conversion, seek table and streaming bookkeeping live here, while the
+     * actual decoding goes through the protected *Source() functions. They forward to the
+     * C virtual table by default, and are overridden by the decoders built in the bindings.
+     */
+    class CDecoder : public Decoder
+    {
+    public:
+        CDecoder(const Codec* codec, std::shared_ptr<const DecoderVTable> v_table, am_voidptr user_data = nullptr)
+            : Decoder(codec)
+            , _v_table(std::move(v_table))
+            , _user_data(user_data)
+            , _codec_name(codec->GetName())
+        {
+            if (_v_table && _v_table->create)
+                _v_table->create(_user_data);
+        }
+
+        ~CDecoder() override
+        {
+            if (_v_table && _v_table->destroy)
+                _v_table->destroy(_user_data);
+
+            _v_table = nullptr;
+            _user_data = nullptr;
+        }
+
+        bool Open(std::shared_ptr<File> file) override
+        {
+            if (!file || !OpenSource(file))
+                return false;
+
+            _path = file->GetPath();
+            _file = file.get();
+            _seek_table = SeekTable::Acquire(_path, _codec_name);
+            _next_frame = 0;
+            UpdateConversion();
+
+            return true;
+        }
+
+        bool Close() override
+        {
+            _path.clear();
+            _file = nullptr;
+            _seek_table.reset();
+
+            return CloseSource();
+        }
+
+        AmUInt64 Load(AudioBuffer* out) override
+        {
+            if (!CanLoad() || !out)
+                return 0;
+
+            return LoadSource(out->GetData().GetBuffer());
+        }
+
+        AmUInt64 Stream(AudioBuffer* out, AmUInt64 bufferOffset, AmUInt64 seekOffset, AmUInt64 length) override
+        {
+            if (!CanStream() || !out)
+                return 0;
+
+            return StreamFrames(out->GetData().GetBuffer(), bufferOffset, seekOffset, length);
+        }
+
+        bool Seek(AmUInt64 offset) override
+        {
+            if (SeekToCheckpoint(offset))
+                return true;
+
+            if (!SeekSource(offset))
+                return false;
+
+            _next_frame = offset;
+            return true;
+        }
+
+        /**
+         * @brief Checks whether the decoder can load whole files.
+         */
+        [[nodiscard]] virtual bool CanLoad() const
+        {
+            return _v_table && _v_table->load;
+        }
+
+        /**
+         * @brief Checks whether the decoder can stream files.
+         */
+        [[nodiscard]] virtual bool CanStream() const
+        {
+            return _v_table && _v_table->stream;
+        }
+
+        /**
+         * @brief Gets a pointer to the encoded frames of the opened file, when they are
+         * stored in the decoder format in memory.
+         *
+         * @param[in] frame The first frame to access.
+         * @param[out] frames The number of frames available from the returned pointer.
+         *
+         * @return A pointer to the frame, or nullptr if the frames cannot be accessed directly.
+         */
+        [[nodiscard]] virtual const void* MapFrames([[maybe_unused]] AmUInt64 frame, AmUInt64& frames) const
+        {
+            frames = 0;
+            return nullptr;
+        }
+
+        /**
+         * @brief Brings the decoder back to its freshly created state.
+         *
+         * @return Whether the decoder can be reused.
+         */
+        bool Reset()
+        {
+            if (!_v_table || !_v_table->reset)
+                return false;
+
+            m_format = SoundFormat();
+            _path.clear();
+            _file = nullptr;
+            _seek_table.reset();
+            _requested_output = am_audio_sample_format_unknown;
+            UpdateConversion();
+
+            return AM_BOOL_TO_BOOL(_v_table->reset(_user_data));
+        }
+
+        /**
+         * @brief Sets the sample format written by LoadRaw() and StreamRaw().
+         *
+         * @return Whether the decoder format can be converted to the requested one.
+         */
+        bool SetOutputFormat(am_audio_sample_format format)
+        {
+            _requested_output = format;
+            UpdateConversion();
+
+            // The conversion is resolved again when a file is opened
+            return format == am_audio_sample_format_unknown || m_format.GetSampleType() == eAudioSampleFormat_Unknown ||
+                _native_type != am_pcm_sample_type_unknown;
+        }
+
+        /**
+         * @brief Gets the format of the frames written by LoadRaw() and StreamRaw().
+         */
+        [[nodiscard]] SoundFormat GetOutputFormat() const
+        {
+            if (_output_type == am_pcm_sample_type_unknown)
+                return m_format;
+
+            const auto sample_size = static_cast<AmUInt32>(get_pcm_sample_size(_output_type));
+
+            SoundFormat format;
+            format.SetAll(
+                m_format.GetSampleRate(), m_format.GetNumChannels(), sample_size * 8, m_format.GetFramesCount(),
+                sample_size * m_format.GetNumChannels(),
+                _output_type == am_pcm_sample_type_float32 ? eAudioSampleFormat_Float32 : eAudioSampleFormat_Int16);
+
+            return format;
+        }
+
+        /**
+         * @brief Loads the entire file into a raw buffer, in the output format.
+         */
+        AmUInt64 LoadRaw(AmVoidPtr out)
+        {
+            if (!CanLoad())
+                return 0;
+
+            if (_output_type == am_pcm_sample_type_unknown)
+                return LoadSource(out);
+
+            // The scratch buffer can only be sized when the decoder knows the length of the file
+            const AmUInt64 frames_count = m_format.GetFramesCount();
+            if (frames_count == 0)
+                return 0;
+
+            _scratch.resize(frames_count * get_frame_size(m_format));
+
+            const AmUInt64 frames = LoadSource(_scratch.data());
+            convert_pcm_samples(_scratch.data(), _native_type, out, _output_type, frames * m_format.GetNumChannels());
+
+            return frames;
+        }
+
+        /**
+         * @brief Streams a portion of the file into a raw buffer, in the output format.
+         */
+        AmUInt64 StreamRaw(AmVoidPtr out, AmUInt64 bufferOffset, AmUInt64 seekOffset, AmUInt64 length)
+        {
+            if (!CanStream())
+                return 0;
+
+            if (_output_type == am_pcm_sample_type_unknown)
+                return StreamFrames(out, bufferOffset, seekOffset, length);
+
+            const AmSize out_frame_size = get_pcm_sample_size(_output_type) * m_format.GetNumChannels();
+            AmUInt8* dst = static_cast<AmUInt8*>(out) + bufferOffset * out_frame_size;
+
+            // Convert straight from the file data when it is mapped in memory
+            AmUInt64 mapped = 0;
+            if (const void* src = MapFrames(seekOffset, mapped))
+            {
+                const AmUInt64 frames = std::min(mapped, length);
+                convert_pcm_samples(src, _native_type, dst, _output_type, frames * m_format.GetNumChannels());
+
+                _next_frame = seekOffset + frames;
+                return frames;
+            }
+            _scratch.resize(length * get_frame_size(m_format));
+
+            const AmUInt64 frames = StreamFrames(_scratch.data(), 0, seekOffset, length);
+            convert_pcm_samples(_scratch.data(), _native_type, dst, _output_type, frames * m_format.GetNumChannels());
+
+            return frames;
+        }
+
+        /**
+         * @brief Gets a pointer to frames of the opened file, when they are stored in memory
+         * in the output format.
+         *
+         * @see MapFrames()
+         */
+        [[nodiscard]] const void* MapRaw(AmUInt64 frame, AmUInt64& frames) const
+        {
+            frames = 0;
+            if (_output_type != am_pcm_sample_type_unknown)
+                return nullptr;
+
+            return MapFrames(frame, frames);
+        }
+
+        /**
+         * @brief Gets the path of the opened file, empty when no file is opened.
+         */
+        [[nodiscard]] const AmOsString& GetPath() const
+        {
+            return _path;
+        }
+
+        /**
+         * @brief Gets the seek table of the opened file, null when no file is opened.
+         */
+        [[nodiscard]] const std::shared_ptr<SeekTable>& GetSeekTable() const
+        {
+            return _seek_table;
+        }
+
+        /**
+         * @brief Gets the name of the codec which created this decoder.
+         */
+        [[nodiscard]] const AmString& GetCodecName() const
+        {
+            return _codec_name;
+        }
+
+    public:
+        std::shared_ptr<const DecoderVTable> _v_table;
+        am_voidptr _user_data;
+
+    protected:
+        /**
+         * @brief Opens the file and fills m_format.
+         */
+        virtual bool OpenSource(const std::shared_ptr<File>& file)
+        {
+            if (!_v_table || !_v_table->open)
+                return false;
+
+            am_file_handle handle = { am_file_type_unknown, file.get() };
+            if (!AM_BOOL_TO_BOOL(_v_table->open(_user_data, handle)))
+                return false;
+
+            if (_v_table->get_format)
+            {
+                am_sound_format format;
+                _v_table->get_format(_user_data, &format);
+                m_format = to_cpp_sound_format(format);
+            }
+
+            return true;
+        }
+
+        virtual bool CloseSource()
+        {
+            if (!_v_table || !_v_table->close)
+                return false;
+
+            return AM_BOOL_TO_BOOL(_v_table->close(_user_data));
+        }
+
+        virtual AmUInt64 LoadSource(AmVoidPtr out)
+        {
+            return _v_table->load(_user_data, out);
+        }
+
+        virtual AmUInt64 StreamSource(AmVoidPtr out, AmUInt64 bufferOffset, AmUInt64 seekOffset, AmUInt64 length)
+        {
+            return _v_table->stream(_user_data, out, bufferOffset, seekOffset, length);
+        }
+
+        virtual bool SeekSource(AmUInt64 offset)
+        {
+            if (!_v_table || !_v_table->seek)
+                return false;
+
+            return AM_BOOL_TO_BOOL(_v_table->seek(_user_data, offset));
+        }
+
+    private:
+        AmUInt64 StreamFrames(AmVoidPtr out, AmUInt64 bufferOffset, AmUInt64 seekOffset, AmUInt64 length)
+        {
+            // Let the decoder resume from a checkpoint instead of reaching the new position by itself
+            if (seekOffset != _next_frame)
+                SeekToCheckpoint(seekOffset);
+
+            const AmUInt64 frames = StreamSource(out, bufferOffset, seekOffset, length);
+
+            _next_frame = seekOffset + frames;
+            RecordCheckpoint();
+
+            return frames;
+        }
+
+        bool SeekToCheckpoint(AmUInt64 frame)
+        {
+            if (!_v_table || !_v_table->seek_to_checkpoint || !_seek_table)
+                return false;
+
+            SeekTable::Point point;
+            if (!_seek_table->FindNearest(frame, point))
+                return false;
+
+            if (!AM_BOOL_TO_BOOL(_v_table->seek_to_checkpoint(_user_data, frame, point.frame, point.offset)))
+                return false;
+
+            _next_frame = frame;
+            return true;
+        }
+
+        void RecordCheckpoint()
+        {
+            // Checkpoints are useless to decoders which cannot resume from them
+            if (!_v_table || !_v_table->seek_to_checkpoint || !_seek_table || _next_frame == 0)
+                return;
+
+            if (_v_table->get_checkpoint)
+            {
+                am_uint64 frame = 0;
+                am_uint64 offset = 0;
+                if (AM_BOOL_TO_BOOL(_v_table->get_checkpoint(_user_data, &frame, &offset)))
+                    _seek_table->Record(frame, offset);
+            }
+            else if (_file)
+            {
+                _seek_table->Record(_next_frame, _file->Position());
+            }
+        }
+
+        void UpdateConversion()
+        {
+            _native_type = get_pcm_sample_type(from_cpp_sample_format(m_format.GetSampleType()), m_format.GetBitsPerSample());
+            _output_type = am_pcm_sample_type_unknown;
+
+            if (_requested_output == am_audio_sample_format_unknown || _native_type == am_pcm_sample_type_unknown)
+                return;
+
+            const am_pcm_sample_type target =
+                _requested_output == am_audio_sample_format_float32 ? am_pcm_sample_type_float32 : am_pcm_sample_type_int16;
+
+            if (target != _native_type)
+                _output_type = target;
+        }
+
+        AmString _codec_name;
+        AmOsString _path;
+
+        am_audio_sample_format _requested_output = am_audio_sample_format_unknown;
+        am_pcm_sample_type _native_type = am_pcm_sample_type_unknown;
+        am_pcm_sample_type _output_type = am_pcm_sample_type_unknown; // Unknown when no conversion is needed
+        std::vector<AmUInt8> _scratch;
+
+        File* _file = nullptr; // Not owned, valid while the file is opened
+        std::shared_ptr<SeekTable> _seek_table;
+        AmUInt64 _next_frame = 0; // Frame the decoder stands at after the last call
+    };
+
+    class CEncoder final : public Encoder
+    {
+    public:
+        explicit CEncoder(const Codec* codec, am_codec_encoder_vtable* v_table, am_voidptr user_data = nullptr)
+            : Encoder(codec)
+            , _v_table(v_table)
+            , _user_data(user_data)
+        {
+            if (_v_table && _v_table->create)
+                _v_table->create(_user_data);
+        }
+
+        ~CEncoder() override
+        {
+            if (_v_table && _v_table->destroy)
+                _v_table->destroy(_user_data);
+
+            _v_table = nullptr;
+            _user_data = nullptr;
+        }
+
+        bool Open(std::shared_ptr<File> file) override
+        {
+            if (!_v_table || !_v_table->open || !file)
+                return false;
+
+            am_file_handle handle = { am_file_type_unknown, file.get() };
+            return AM_BOOL_TO_BOOL(_v_table->open(_user_data, handle));
+        }
+
+        bool Close() override
+        {
+            if (!_v_table || !_v_table->close)
+                return false;
+
+            return AM_BOOL_TO_BOOL(_v_table->close(_user_data));
+        }
+
+        void SetFormat(const SoundFormat& format) override
+        {
+            Encoder::SetFormat(format);
+
+            if (_v_table && _v_table->set_format)
+            {
+                am_sound_format c_format = from_cpp_sound_format(format);
+                _v_table->set_format(_user_data, &c_format);
+            }
+        }
+
+        AmUInt64 Write(AudioBuffer* in, AmUInt64 offset, AmUInt64 length) override
+        {
+            if (!_v_table || !_v_table->write || !in)
+                return 0;
+
+            return _v_table->write(_user_data, in->GetData().GetBuffer(), offset, length);
+        }
+
+        /**
+         * @brief Gets the format of the frames given to the encoder.
+         */
+        [[nodiscard]] const SoundFormat& GetFormat() const
+        {
+            return m_format;
+        }
+
+    public:
+        am_codec_encoder_vtable* _v_table;
+        am_voidptr _user_data;
+    };
+
+    /**
+     * @brief Idle decoders kept for reuse.
+     *
+     * The pool is shared with the deleters of the decoders handed out by CreateDecoder(),
+     * so decoders destroyed after the codec was unregistered are simply released.
+     */
+    struct DecoderPool
+    {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<CDecoder>> decoders;
+        AmSize max_size = kDefaultDecoderPoolSize;
+
+        void Release(std::shared_ptr<CDecoder> decoder)
+        {
+            if (!decoder->Reset())
+                return;
+
+            std::lock_guard lock(mutex);
+            if (decoders.size() < max_size)
+                decoders.push_back(std::move(decoder));
+        }
+    };
+
+    static constexpr AmSize kDefaultDecoderPoolSize = 16;
+
+    explicit CCodec(const am_codec_config& config)
+        : Codec(config.name)
+        , _config(config)
+        , _decoder_v_table(nullptr)
+        , _decoder_pool(std::make_shared<DecoderPool>())
+    {
+        if (_config.decoder.v_table)
+        {
+            auto v_table = ampoolshared(eMemoryPoolKind_Codec, DecoderVTable);
+            static_cast<am_codec_decoder_vtable&>(*v_table) = *_config.decoder.v_table;
+
+            if (_config.decoder_ext_v_table)
+            {
+                // Only copy what the caller's structure holds, the functions it does not cover stay NULL
+                am_codec_decoder_ext_vtable ext = {};
+                std::memcpy(
+                    &ext, _config.decoder_ext_v_table,
+                    std::min(_config.decoder_ext_v_table->struct_size, sizeof(am_codec_decoder_ext_vtable)));
+
+                v_table->reset = ext.reset;
+                v_table->seek_to_checkpoint = ext.seek_to_checkpoint;
+                v_table->get_checkpoint = ext.get_checkpoint;
+            }
+
+            _decoder_v_table = std::move(v_table);
+        }
+
+        // The tables are copied, the caller's structures are not referenced after registration
+        _config.decoder.v_table = nullptr;
+        _config.decoder_ext_v_table = nullptr;
+
+        if (_config.v_table && _config.v_table->on_register)
+            _config.v_table->on_register(_config.user_data);
+    }
+
+    ~CCodec() override
+    {
+        if (_config.v_table && _config.v_table->on_unregister)
+            _config.v_table->on_unregister(_config.user_data);
+    }
+
+    std::shared_ptr<Decoder> CreateDecoder() override
+    {
+        if (!_decoder_v_table)
+            return nullptr;
+
+        if (!_decoder_v_table->reset)
+            return ampoolshared(eMemoryPoolKind_Codec, CDecoder, this, _decoder_v_table, _config.decoder.user_data);
+
+        std::shared_ptr<CDecoder> decoder = nullptr;
+
+        {
+            std::lock_guard lock(_decoder_pool->mutex);
+            if (!_decoder_pool->decoders.empty())
+            {
+                decoder = std::move(_decoder_pool->decoders.back());
+                _decoder_pool->decoders.pop_back();
+            }
+        }
+
+        if (!decoder)
+            decoder = ampoolshared(eMemoryPoolKind_Codec, CDecoder, this, _decoder_v_table, _config.decoder.user_data);
+
+        // Hand out a shared_ptr which gives the decoder back to the pool instead of destroying it
+        std::weak_ptr<DecoderPool> pool = _decoder_pool;
+        CDecoder* raw_decoder = decoder.get();
+
+        return std::shared_ptr<Decoder>(
+            raw_decoder,
+            [pool, decoder = std::move(decoder)](Decoder*) mutable
+            {
+                if (const auto p = pool.lock())
+                    p->Release(std::move(decoder));
+            });
+    }
+
+    /**
+     * @brief Sets the maximum number of idle decoders kept in the pool.
+     */
+    void SetDecoderPoolSize(AmSize size)
+    {
+        std::vector<std::shared_ptr<CDecoder>> released;
+
+        {
+            std::lock_guard lock(_decoder_pool->mutex);
+            _decoder_pool->max_size = size;
+
+            while (_decoder_pool->decoders.size() > size)
+            {
+                released.push_back(std::move(_decoder_pool->decoders.back()));
+                _decoder_pool->decoders.pop_back();
+            }
+        }
+
+        // Released decoders are destroyed here, outside the pool lock
+    }
+
+    /**
+     * @brief Gets the number of idle decoders in the pool.
+     */
+    [[nodiscard]] AmSize GetDecoderPoolCount() const
+    {
+        std::lock_guard lock(_decoder_pool->mutex);
+        return _decoder_pool->decoders.size();
+    }
+
+    std::shared_ptr<Encoder> CreateEncoder() override
+    {
+        if (!_config.encoder.v_table)
+            return nullptr;
+
+        return ampoolshared(eMemoryPoolKind_Codec, CEncoder, this, _config.encoder.v_table, _config.encoder.user_data);
+    }
+
+    [[nodiscard]] bool CanHandleFile(std::shared_ptr<File> file) const override
+    {
+        if (!_config.v_table || !_config.v_table->on_can_handle_file || !file)
+            return false;
+
+        am_file_handle handle = { am_file_type_unknown, file.get() };
+        return AM_BOOL_TO_BOOL(_config.v_table->on_can_handle_file(_config.user_data, handle));
+    }
+
+private:
+    am_codec_config _config;
+    std::shared_ptr<const DecoderVTable> _decoder_v_table;
+    std::shared_ptr<DecoderPool> _decoder_pool;
+};
+
+#endif // _AM_IMPLEMENTATION_CODEC_INTERNALS_H
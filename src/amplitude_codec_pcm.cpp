@@ -0,0 +1,294 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_codec_internals.h"
+#include "amplitude_stats.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+static constexpr const char *kPcmCodecName = "pcm";
+
+static constexpr AmUInt16 kWaveFormatPcm = 0x0001;
+static constexpr AmUInt16 kWaveFormatIeeeFloat = 0x0003;
+static constexpr AmUInt16 kWaveFormatExtensible = 0xFFFE;
+
+static AmUInt16 read_le16(const AmUInt8 *data) {
+  return static_cast<AmUInt16>(data[0] | (data[1] << 8));
+}
+
+static AmUInt32 read_le32(const AmUInt8 *data) {
+  return static_cast<AmUInt32>(data[0]) |
+         (static_cast<AmUInt32>(data[1]) << 8) |
+         (static_cast<AmUInt32>(data[2]) << 16) |
+         (static_cast<AmUInt32>(data[3]) << 24);
+}
+
+static bool is_wave_header(const AmUInt8 *header) {
+  return std::memcmp(header, "RIFF", 4) == 0 &&
+         std::memcmp(header + 8, "WAVE", 4) == 0;
+}
+
+struct WaveInfo {
+  SoundFormat format;
+  AmSize data_offset;
+};
+
+/**
+ * @brief Reads the format and locates the samples of a WAV file.
+ *
+ * Only 16, 24 and 32-bit integer, and 32-bit float samples are supported.
+ */
+static bool read_wave_info(File *file, WaveInfo &info) {
+  AmUInt8 header[12];
+
+  file->Seek(0, eFileSeekOrigin_Start);
+  if (file->Read(header, sizeof(header)) != sizeof(header) ||
+      !is_wave_header(header))
+    return false;
+
+  const AmSize length = file->Length();
+  bool has_format = false;
+  AmUInt16 tag = 0, num_channels = 0, block_align = 0, bits_per_sample = 0;
+  AmUInt32 sample_rate = 0;
+
+  AmUInt8 chunk[8];
+  while (file->Read(chunk, sizeof(chunk)) == sizeof(chunk)) {
+    const AmUInt32 size = read_le32(chunk + 4);
+    const AmSize position = file->Position();
+
+    if (std::memcmp(chunk, "fmt ", 4) == 0) {
+      AmUInt8 fmt[40] = {};
+      if (size < 16 || file->Read(fmt, std::min<AmSize>(size, 40)) < 16)
+        return false;
+
+      tag = read_le16(fmt);
+      num_channels = read_le16(fmt + 2);
+      sample_rate = read_le32(fmt + 4);
+      block_align = read_le16(fmt + 12);
+      bits_per_sample = read_le16(fmt + 14);
+
+      // The actual format is the first field of the sub-format GUID
+      if (tag == kWaveFormatExtensible && size >= 40)
+        tag = read_le16(fmt + 24);
+
+      has_format = true;
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (!has_format || num_channels == 0 || sample_rate == 0 ||
+          block_align != num_channels * (bits_per_sample / 8))
+        return false;
+
+      eAudioSampleFormat sample_type = eAudioSampleFormat_Unknown;
+      if (tag == kWaveFormatPcm &&
+          (bits_per_sample == 16 || bits_per_sample == 24 ||
+           bits_per_sample == 32))
+        sample_type = eAudioSampleFormat_Int16;
+      else if (tag == kWaveFormatIeeeFloat && bits_per_sample == 32)
+        sample_type = eAudioSampleFormat_Float32;
+      else
+        return false;
+
+      // Streamed files may leave the size unset, trust the file length then
+      const AmSize data_size =
+          std::min<AmSize>(size, length > position ? length - position : 0);
+
+      info.format.SetAll(sample_rate, num_channels, bits_per_sample,
+                         data_size / block_align, block_align, sample_type);
+      info.data_offset = position;
+      return true;
+    }
+
+    // Chunks are padded to an even size
+    file->Seek(static_cast<AmInt64>(position + size + (size & 1)),
+               eFileSeekOrigin_Start);
+  }
+
+  return false;
+}
+
+/**
+ * @brief Codec reading uncompressed WAV files natively.
+ *
+ * Frames are read straight into the output buffer, or copied from the file
+ * memory when it is mapped, without any call through a C virtual table.
+ */
+class PcmCodec final : public Codec {
+public:
+  class PcmDecoder final : public CCodec::CDecoder {
+  public:
+    explicit PcmDecoder(const Codec *codec) : CDecoder(codec, nullptr) {}
+
+    [[nodiscard]] bool CanLoad() const override { return _source != nullptr; }
+
+    [[nodiscard]] bool CanStream() const override {
+      return _source != nullptr;
+    }
+
+    [[nodiscard]] const void *MapFrames(AmUInt64 frame,
+                                        AmUInt64 &frames) const override {
+      frames = 0;
+
+      const AmUInt64 frames_count = m_format.GetFramesCount();
+      if (!_mapped || frame >= frames_count)
+        return nullptr;
+
+      frames = frames_count - frame;
+      return _mapped + frame * m_format.GetFrameSize();
+    }
+
+  protected:
+    bool OpenSource(const std::shared_ptr<File> &file) override {
+      WaveInfo info;
+      if (!read_wave_info(file.get(), info))
+        return false;
+
+      m_format = info.format;
+      _source = file.get();
+      _data_offset = info.data_offset;
+      _cursor = AmUInt64(-1);
+
+      const auto *memory = static_cast<const AmUInt8 *>(file->GetPtr());
+      _mapped = memory ? memory + _data_offset : nullptr;
+
+      return true;
+    }
+
+    bool CloseSource() override {
+      _source = nullptr;
+      _mapped = nullptr;
+      return true;
+    }
+
+    AmUInt64 LoadSource(AmVoidPtr out) override {
+      return StreamSource(out, 0, 0, m_format.GetFramesCount());
+    }
+
+    AmUInt64 StreamSource(AmVoidPtr out, AmUInt64 bufferOffset,
+                          AmUInt64 seekOffset, AmUInt64 length) override {
+      const AmUInt64 frames_count = m_format.GetFramesCount();
+      if (seekOffset >= frames_count)
+        return 0;
+
+      const AmSize frame_size = m_format.GetFrameSize();
+      const AmUInt64 frames = std::min(length, frames_count - seekOffset);
+      auto *dst = static_cast<AmUInt8 *>(out) + bufferOffset * frame_size;
+
+      if (_mapped) {
+        std::memcpy(dst, _mapped + seekOffset * frame_size, frames * frame_size);
+        return frames;
+      }
+
+      // Only seek when the previous call did not stop right there
+      if (_cursor != seekOffset)
+        _source->Seek(
+            static_cast<AmInt64>(_data_offset + seekOffset * frame_size),
+            eFileSeekOrigin_Start);
+
+      const AmUInt64 read = _source->Read(dst, frames * frame_size) / frame_size;
+      _cursor = seekOffset + read;
+
+      return read;
+    }
+
+    bool SeekSource(AmUInt64 offset) override {
+      if (!_source || offset > m_format.GetFramesCount())
+        return false;
+
+      if (!_mapped)
+        _source->Seek(static_cast<AmInt64>(_data_offset +
+                                           offset * m_format.GetFrameSize()),
+                      eFileSeekOrigin_Start);
+
+      _cursor = offset;
+      return true;
+    }
+
+  private:
+    File *_source = nullptr; // Not owned, valid while the file is opened
+    const AmUInt8 *_mapped = nullptr;
+    AmSize _data_offset = 0;
+    AmUInt64 _cursor = 0;
+  };
+
+  PcmCodec() : Codec(kPcmCodecName) {}
+
+  std::shared_ptr<Decoder> CreateDecoder() override {
+    return ampoolshared(eMemoryPoolKind_Codec, PcmDecoder, this);
+  }
+
+  std::shared_ptr<Encoder> CreateEncoder() override { return nullptr; }
+
+  [[nodiscard]] bool CanHandleFile(std::shared_ptr<File> file) const override {
+    if (!file)
+      return false;
+
+    // Other codecs may handle WAV files with compressed samples, so check the
+    // sample format too
+    WaveInfo info;
+    const AmSize position = file->Position();
+    const bool supported = read_wave_info(file.get(), info);
+    file->Seek(static_cast<AmInt64>(position), eFileSeekOrigin_Start);
+
+    return supported;
+  }
+};
+
+extern "C" {
+
+am_codec_handle am_codec_register_pcm(void) {
+  AM_STATS_SCOPE(codec);
+  auto codec = Codec::Find(kPcmCodecName);
+
+  if (!codec) {
+    // No probe signature: the RIFF header does not tell the sample format,
+    // and a signature match skips the other codecs
+    codec = ampoolshared(eMemoryPoolKind_Codec, PcmCodec);
+    Codec::Register(codec);
+
+    // Paths probed before may belong to the new codec
+    am_codec_probe_cache_clear();
+  }
+
+  return reinterpret_cast<am_codec_handle>(codec.get());
+}
+
+const void *am_codec_decoder_map(am_codec_decoder_handle handle,
+                                 am_uint64 frame, am_uint64 *frames) {
+  AM_STATS_SCOPE(codec);
+  if (!handle || !frames)
+    return nullptr;
+
+  *frames = 0;
+
+  auto decoder = GET_SHARED_PTR(Codec::Decoder, handle);
+  if (!decoder)
+    return nullptr;
+
+  auto c_decoder = dynamic_cast<CCodec::CDecoder *>(decoder.get());
+  if (!c_decoder)
+    return nullptr;
+
+  AmUInt64 available = 0;
+  const void *data = c_decoder->MapRaw(frame, available);
+
+  *frames = available;
+  return data;
+}
+
+} // extern "C"
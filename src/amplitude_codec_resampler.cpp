@@ -0,0 +1,471 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_codec_internals.h"
+#include "amplitude_sample_conversion.h"
+#include "amplitude_simd.h"
+#include "amplitude_stats.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+// Fraction of the output Nyquist frequency kept by the sinc filter
+static constexpr double kSincRolloff = 0.92;
+
+// Kaiser window shape, about 80 dB of stopband attenuation
+static constexpr double kKaiserBeta = 8.0;
+
+static constexpr double kPi = 3.14159265358979323846;
+
+static double bessel_i0(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+  const double half_x = x * 0.5;
+
+  for (int k = 1; k < 32; ++k) {
+    term *= half_x / k;
+    sum += term * term;
+  }
+
+  return sum;
+}
+
+static float dot_product(const float *a, const float *b, AmSize count) {
+  AmSize i = 0;
+  float result = 0.0f;
+
+#if AM_C_SIMD_AVX2
+  __m256 acc = _mm256_setzero_ps();
+  for (; i + 8 <= count; i += 8)
+    acc = _mm256_add_ps(
+        acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+
+  __m128 sum =
+      _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  result = _mm_cvtss_f32(sum);
+#elif AM_C_SIMD_SSE2
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  for (; i + 8 <= count; i += 8) {
+    acc0 = _mm_add_ps(acc0,
+                      _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    acc1 = _mm_add_ps(
+        acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+  }
+
+  __m128 sum = _mm_add_ps(acc0, acc1);
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  result = _mm_cvtss_f32(sum);
+#elif AM_C_SIMD_NEON
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  for (; i + 8 <= count; i += 8) {
+    acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+    acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+  }
+
+  const float32x4_t sum = vaddq_f32(acc0, acc1);
+  const float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  result = vget_lane_f32(vpadd_f32(pair, pair), 0);
+#endif
+
+  for (; i < count; ++i)
+    result += a[i] * b[i];
+
+  return result;
+}
+
+/**
+ * @brief Streaming sample rate converter reading from a decoder.
+ *
+ * Source frames are converted to float and stored planar, so that each output
+ * sample is a contiguous dot product between the history of its channel and an
+ * interpolated row of the polyphase filter bank.
+ *
+ * The position in the source is tracked as an integer frame plus an exact
+ * fraction over the reduced target rate, so long streams never drift.
+ */
+class CodecResampler final {
+public:
+  CodecResampler(std::shared_ptr<CCodec::CDecoder> decoder,
+                 const am_codec_resampler_config &config)
+      : _decoder(std::move(decoder)), _config(config),
+        _source_format(_decoder->GetOutputFormat()),
+        _source_type(get_pcm_sample_type(
+            from_cpp_sample_format(_source_format.GetSampleType()),
+            _source_format.GetBitsPerSample())),
+        _num_channels(_source_format.GetNumChannels()) {
+    const AmUInt32 source_rate = _source_format.GetSampleRate();
+    const AmUInt32 gcd = std::gcd(source_rate, _config.sample_rate);
+
+    if (gcd > 0) {
+      _step = source_rate / gcd;
+      _denominator = _config.sample_rate / gcd;
+    }
+
+    if (_config.chunk_size == 0)
+      _config.chunk_size = 1024;
+
+    if (_config.quality == am_resampler_quality_sinc) {
+      _taps = std::max<AmSize>((_config.filter_length + 7) & ~7u, 8);
+      _phases = std::max<AmUInt32>(_config.filter_phases, 1);
+      BuildFilter(static_cast<double>(source_rate));
+    } else {
+      _taps = 2;
+    }
+
+    _half = _taps / 2;
+    _capacity = _taps + _config.chunk_size;
+
+    _coefficients.resize(_taps);
+    _history.assign(_num_channels, std::vector<float>(_capacity, 0.0f));
+    _decoded.resize(_config.chunk_size * get_frame_size(_source_format));
+    _interleaved.resize(_config.chunk_size * _num_channels);
+    _planar.resize(_num_channels);
+
+    if (_denominator > 0)
+      Reset(0);
+  }
+
+  [[nodiscard]] bool IsValid() const {
+    return _denominator > 0 && _num_channels > 0 &&
+           _source_type != am_pcm_sample_type_unknown &&
+           _decoder->CanStream();
+  }
+
+  [[nodiscard]] AmUInt16 GetNumChannels() const { return _num_channels; }
+
+  [[nodiscard]] SoundFormat GetFormat() const {
+    // Output frame k reads the source at k * step / denominator, which must
+    // stay before the end of the file
+    const AmUInt64 frames_count =
+        (_source_format.GetFramesCount() * _denominator + _step - 1) / _step;
+
+    SoundFormat format;
+    format.SetAll(_config.sample_rate, _num_channels, 32, frames_count,
+                  sizeof(float) * _num_channels, eAudioSampleFormat_Float32);
+
+    return format;
+  }
+
+  AmUInt64 Stream(float *out, AmUInt64 seek_offset, AmUInt64 length) {
+    if (seek_offset != _position)
+      Reset(seek_offset);
+
+    AmUInt64 produced = 0;
+
+    while (produced < length) {
+      if (_read_index + _taps > _available) {
+        if (!Fill())
+          break;
+
+        continue;
+      }
+
+      if (_config.quality == am_resampler_quality_sinc)
+        InterpolateFilter();
+      else
+        InterpolateLinear();
+
+      for (AmUInt16 c = 0; c < _num_channels; ++c)
+        out[c] = dot_product(_history[c].data() + _read_index,
+                             _coefficients.data(), _taps);
+
+      out += _num_channels;
+      ++produced;
+
+      _fraction += _step;
+      _read_index += _fraction / _denominator;
+      _fraction %= _denominator;
+    }
+
+    _position += produced;
+    return produced;
+  }
+
+private:
+  void BuildFilter(double source_rate) {
+    const double ratio =
+        std::min(1.0, static_cast<double>(_config.sample_rate) / source_rate);
+    const double cutoff = ratio * kSincRolloff;
+    const double half = static_cast<double>(_taps / 2);
+    const double window_scale = 1.0 / bessel_i0(kKaiserBeta);
+
+    // One extra row so that the last phase can be interpolated towards the
+    // first phase of the next frame
+    _filter.assign((_phases + 1) * _taps, 0.0f);
+
+    for (AmUInt32 p = 0; p <= _phases; ++p) {
+      const double fraction = static_cast<double>(p) / _phases;
+      float *row = _filter.data() + p * _taps;
+      double sum = 0.0;
+
+      for (AmSize t = 0; t < _taps; ++t) {
+        const double x = static_cast<double>(t) - (half - 1.0) - fraction;
+        const double r = x / half;
+        if (r <= -1.0 || r >= 1.0)
+          continue;
+
+        const double y = cutoff * x;
+        const double sinc = y == 0.0 ? 1.0 : std::sin(kPi * y) / (kPi * y);
+        const double window =
+            bessel_i0(kKaiserBeta * std::sqrt(1.0 - r * r)) * window_scale;
+
+        row[t] = static_cast<float>(cutoff * sinc * window);
+        sum += row[t];
+      }
+
+      // Normalize each phase for unity gain at DC
+      if (sum != 0.0)
+        for (AmSize t = 0; t < _taps; ++t)
+          row[t] = static_cast<float>(row[t] / sum);
+    }
+  }
+
+  void InterpolateFilter() {
+    const AmUInt64 scaled = _fraction * _phases;
+    const AmUInt64 phase = scaled / _denominator;
+    const float mu = static_cast<float>(scaled % _denominator) /
+                     static_cast<float>(_denominator);
+
+    const float *a = _filter.data() + phase * _taps;
+    const float *b = a + _taps;
+
+    for (AmSize t = 0; t < _taps; ++t)
+      _coefficients[t] = a[t] + mu * (b[t] - a[t]);
+  }
+
+  void InterpolateLinear() {
+    const float mu =
+        static_cast<float>(_fraction) / static_cast<float>(_denominator);
+
+    _coefficients[0] = 1.0f - mu;
+    _coefficients[1] = mu;
+  }
+
+  void Reset(AmUInt64 position) {
+    const AmUInt64 source = position * _step / _denominator;
+    const AmUInt64 first =
+        source >= _half - 1 ? source - (_half - 1) : AmUInt64(0);
+
+    // Pad with silence when the filter reaches before the start of the file
+    _available = (_half - 1) - static_cast<AmSize>(source - first);
+    for (auto &history : _history)
+      std::fill_n(history.begin(), _available, 0.0f);
+
+    _read_index = 0;
+    _fraction = position * _step % _denominator;
+    _cursor = first;
+    _skip = 0;
+    _position = position;
+    _eof = false;
+    _flushed = false;
+  }
+
+  bool Fill() {
+    if (_read_index >= _available) {
+      // When the source rate is much higher than the target rate, one output
+      // frame can move the filter past everything buffered
+      _skip += _read_index - _available;
+      _available = 0;
+      _read_index = 0;
+    } else if (_read_index > 0) {
+      for (auto &history : _history)
+        std::copy(history.begin() + _read_index, history.begin() + _available,
+                  history.begin());
+
+      _available -= _read_index;
+      _read_index = 0;
+    }
+
+    const AmSize space = _capacity - _available;
+    if (space == 0)
+      return false;
+
+    AmUInt64 read = 0;
+    AmUInt64 skipped = 0;
+
+    while (read == skipped) {
+      if (_eof) {
+        if (_flushed)
+          return false;
+
+        // Let the filter run past the last source frame
+        const AmSize padding = std::min<AmSize>(
+            _half - std::min<AmUInt64>(_skip, _half), space);
+        for (auto &history : _history)
+          std::fill_n(history.begin() + _available, padding, 0.0f);
+
+        _available += padding;
+        _skip = 0;
+        _flushed = true;
+        return true;
+      }
+
+      const AmUInt64 length =
+          std::min<AmUInt64>(space + _skip, _config.chunk_size);
+      read = _decoder->StreamRaw(_decoded.data(), 0, _cursor, length);
+
+      _cursor += read;
+      if (read < length)
+        _eof = true;
+
+      // Frames the filter jumped over are decoded but not kept
+      skipped = std::min<AmUInt64>(_skip, read);
+      _skip -= skipped;
+    }
+
+    const float *samples = reinterpret_cast<const float *>(_decoded.data());
+    if (_source_type != am_pcm_sample_type_float32) {
+      convert_pcm_samples(_decoded.data(), _source_type, _interleaved.data(),
+                          am_pcm_sample_type_float32, read * _num_channels);
+      samples = _interleaved.data();
+    }
+
+    for (AmUInt16 c = 0; c < _num_channels; ++c)
+      _planar[c] = _history[c].data() + _available;
+
+    am_codec_samples_deinterleave(samples + skipped * _num_channels,
+                                  _planar.data(), _num_channels,
+                                  read - skipped);
+
+    _available += read - skipped;
+    return true;
+  }
+
+  std::shared_ptr<CCodec::CDecoder> _decoder;
+  am_codec_resampler_config _config;
+
+  SoundFormat _source_format;
+  am_pcm_sample_type _source_type;
+  AmUInt16 _num_channels;
+
+  // Source frames advanced per output frame, as step / denominator
+  AmUInt64 _step = 0;
+  AmUInt64 _denominator = 0;
+
+  AmSize _taps = 0;
+  AmSize _half = 0;
+  AmUInt32 _phases = 0;
+  std::vector<float> _filter; // (_phases + 1) rows of _taps coefficients
+  std::vector<float> _coefficients;
+
+  // Planar source frames, _history[c][_read_index] is the first frame under
+  // the filter
+  AmSize _capacity = 0;
+  AmSize _available = 0;
+  AmSize _read_index = 0;
+  std::vector<std::vector<float>> _history;
+
+  std::vector<AmUInt8> _decoded;
+  std::vector<float> _interleaved;
+  std::vector<float *> _planar;
+
+  AmUInt64 _fraction = 0;
+  AmUInt64 _cursor = 0;
+  AmUInt64 _skip = 0; // Source frames to drop before the next buffered one
+  AmUInt64 _position = 0;
+  bool _eof = false;
+  bool _flushed = false;
+};
+
+extern "C" {
+
+am_codec_resampler_config am_codec_resampler_config_init(am_uint32 sample_rate) {
+  AM_STATS_SCOPE(codec);
+  am_codec_resampler_config config;
+
+  config.sample_rate = sample_rate;
+  config.quality = am_resampler_quality_sinc;
+  config.filter_length = 32;
+  config.filter_phases = 256;
+  config.chunk_size = 1024;
+
+  return config;
+}
+
+am_codec_resampler_handle
+am_codec_resampler_create(am_codec_decoder_handle decoder,
+                          const am_codec_resampler_config *config) {
+  AM_STATS_SCOPE(codec);
+  if (!decoder || !config || config->sample_rate == 0)
+    return nullptr;
+
+  auto decoder_ptr = GET_SHARED_PTR(Codec::Decoder, decoder);
+  if (!decoder_ptr)
+    return nullptr;
+
+  auto c_decoder = std::dynamic_pointer_cast<CCodec::CDecoder>(decoder_ptr);
+  if (!c_decoder)
+    return nullptr;
+
+  auto resampler =
+      ampoolshared(eMemoryPoolKind_Codec, CodecResampler, c_decoder, *config);
+  if (!resampler->IsValid())
+    return nullptr;
+
+  return reinterpret_cast<am_codec_resampler_handle>(
+      STORE_SHARED_PTR(CodecResampler, resampler));
+}
+
+void am_codec_resampler_destroy(am_codec_resampler_handle resampler) {
+  AM_STATS_SCOPE(codec);
+  if (!resampler)
+    return;
+
+  REMOVE_SHARED_PTR(CodecResampler, resampler);
+}
+
+am_bool am_codec_resampler_get_format(am_codec_resampler_handle resampler,
+                                      am_sound_format *format) {
+  AM_STATS_SCOPE(codec);
+  if (!resampler || !format)
+    return AM_FALSE;
+
+  auto resampler_ptr = GET_SHARED_PTR(CodecResampler, resampler);
+  if (!resampler_ptr)
+    return AM_FALSE;
+
+  *format = from_cpp_sound_format(resampler_ptr->GetFormat());
+  return AM_TRUE;
+}
+
+am_uint64 am_codec_resampler_stream(am_codec_resampler_handle resampler,
+                                    am_float32 *out, am_uint64 buffer_offset,
+                                    am_uint64 seek_offset, am_uint64 length) {
+  AM_STATS_SCOPE(codec);
+  if (!resampler || !out)
+    return 0;
+
+  auto resampler_ptr = GET_SHARED_PTR(CodecResampler, resampler);
+  if (!resampler_ptr)
+    return 0;
+
+  return resampler_ptr->Stream(
+      out + buffer_offset * resampler_ptr->GetNumChannels(), seek_offset,
+      length);
+}
+
+} // extern "C"
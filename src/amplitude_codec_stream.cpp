@@ -0,0 +1,336 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_codec_internals.h"
+#include "amplitude_ring_buffer.h"
+#include "amplitude_stats.h"
+#include "amplitude_trace.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+class CodecStream final : public std::enable_shared_from_this<CodecStream> {
+public:
+  CodecStream(std::shared_ptr<CCodec::CDecoder> decoder,
+              const am_codec_stream_config &config)
+      : _decoder(std::move(decoder)), _config(config),
+        _frames_count(_decoder->GetFormat().GetFramesCount()),
+        _ring(eMemoryPoolKind_SoundData, config.capacity,
+              get_frame_size(_decoder->GetOutputFormat())) {
+    if (_config.chunk_size == 0 || _config.chunk_size > _config.capacity)
+      _config.chunk_size = _config.capacity;
+  }
+
+  [[nodiscard]] bool IsValid() const {
+    return _ring.IsValid() && _decoder->CanStream();
+  }
+
+  AmUInt64 Read(AmVoidPtr dst, AmUInt64 frames) {
+    LockConsumer();
+    const AmUInt64 read = _ring.Read(dst, frames);
+
+    AmUInt64 position = _position.load(std::memory_order_relaxed) + read;
+    if (_config.loop && _frames_count > 0)
+      position %= _frames_count;
+
+    _position.store(position, std::memory_order_release);
+    UnlockConsumer();
+
+    if (_ring.GetReadAvailable() <= _config.low_watermark &&
+        !_eof.load(std::memory_order_acquire))
+      RequestRefill();
+
+    return read;
+  }
+
+  AmUInt64 Refill() {
+    bool expected = false;
+    if (!_refilling.compare_exchange_strong(expected, true,
+                                            std::memory_order_acquire))
+      return 0; // Another refill is in progress
+
+    AmUInt64 total = 0;
+    bool starved = false;
+
+    while (!_closing.load(std::memory_order_relaxed) &&
+           !_eof.load(std::memory_order_relaxed)) {
+      const AmUInt64 length = std::min<AmUInt64>(
+          _ring.GetContiguousWriteAvailable(), _config.chunk_size);
+      if (length == 0)
+        break;
+
+      const AmUInt64 read = _decoder->StreamRaw(
+          _ring.GetData(), _ring.GetWriteIndex(), _cursor, length);
+
+      _ring.CommitWrite(read);
+      _cursor += read;
+      total += read;
+
+      // Decoders may return less than asked for before the end of the file,
+      // only an empty read marks the end
+      if (read > 0) {
+        starved = false;
+        continue;
+      }
+
+      // Stop unless we can loop and the previous attempt was not already
+      // empty, which would mean an empty file
+      if (!_config.loop || starved) {
+        _eof.store(true, std::memory_order_release);
+        break;
+      }
+
+      _cursor = 0;
+      starved = true;
+    }
+
+    _refilling.store(false, std::memory_order_release);
+    return total;
+  }
+
+  bool Seek(AmUInt64 frame) {
+    // Resetting the ring moves both cursors, so it needs both sides. Wait for
+    // any in-flight read, then for any in-flight refill.
+    LockConsumer();
+
+    bool expected = false;
+    while (!_refilling.compare_exchange_weak(expected, true,
+                                             std::memory_order_acquire)) {
+      expected = false;
+      std::this_thread::yield();
+    }
+
+    _ring.Reset();
+    _cursor = frame;
+    _position.store(frame, std::memory_order_release);
+    _eof.store(false, std::memory_order_relaxed);
+
+    _refilling.store(false, std::memory_order_release);
+    UnlockConsumer();
+
+    if (_config.pool)
+      RequestRefill();
+    else
+      Refill();
+
+    return true;
+  }
+
+  void Close() { _closing.store(true, std::memory_order_relaxed); }
+
+  [[nodiscard]] AmUInt64 GetAvailable() const {
+    return _ring.GetReadAvailable();
+  }
+
+  [[nodiscard]] AmUInt64 GetPosition() const {
+    return _position.load(std::memory_order_acquire);
+  }
+
+  [[nodiscard]] bool IsFinished() const {
+    return _eof.load(std::memory_order_acquire) &&
+           _ring.GetReadAvailable() == 0;
+  }
+
+private:
+  class RefillTask final : public Thread::PoolTask {
+  public:
+    explicit RefillTask(std::shared_ptr<CodecStream> stream)
+        : _stream(std::move(stream)) {}
+
+    void Work() override {
+      _stream->_refill_pending.store(false, std::memory_order_release);
+      _stream->Refill();
+    }
+
+    bool Ready() override { return true; }
+
+  private:
+    std::shared_ptr<CodecStream> _stream;
+  };
+
+  // Reads and seeks may come from different threads. Seeks are rare, so a
+  // spin lock keeps the uncontended read path to a single exchange.
+  void LockConsumer() {
+    while (_consuming.exchange(true, std::memory_order_acquire))
+      std::this_thread::yield();
+  }
+
+  void UnlockConsumer() { _consuming.store(false, std::memory_order_release); }
+
+  void RequestRefill() {
+    if (!_config.pool || _closing.load(std::memory_order_relaxed))
+      return;
+
+    if (_refill_pending.exchange(true, std::memory_order_acq_rel))
+      return; // A refill is already scheduled
+
+    reinterpret_cast<Thread::Pool *>(_config.pool)
+        ->AddTask(ampoolshared(eMemoryPoolKind_Codec, RefillTask,
+                               shared_from_this()));
+  }
+
+  std::shared_ptr<CCodec::CDecoder> _decoder;
+  am_codec_stream_config _config;
+  AmUInt64 _frames_count;
+
+  SpscRingBuffer _ring;
+
+  // Producer side
+  AmUInt64 _cursor = 0;
+  std::atomic<bool> _refilling = false;
+  std::atomic<bool> _refill_pending = false;
+  std::atomic<bool> _eof = false;
+  std::atomic<bool> _closing = false;
+
+  // Consumer side
+  std::atomic<bool> _consuming = false;
+  std::atomic<AmUInt64> _position = 0;
+};
+
+extern "C" {
+
+am_codec_stream_config am_codec_stream_config_init(void) {
+  AM_STATS_SCOPE(codec);
+  am_codec_stream_config config;
+
+  config.capacity = 16384;
+  config.low_watermark = 8192;
+  config.chunk_size = 4096;
+  config.loop = AM_FALSE;
+  config.pool = nullptr;
+
+  return config;
+}
+
+am_codec_stream_handle
+am_codec_stream_create(am_codec_decoder_handle decoder,
+                       const am_codec_stream_config *config) {
+  AM_STATS_SCOPE(codec);
+  if (!decoder || !config || config->capacity == 0)
+    return nullptr;
+
+  auto decoder_ptr = GET_SHARED_PTR(Codec::Decoder, decoder);
+  if (!decoder_ptr)
+    return nullptr;
+
+  auto c_decoder = std::dynamic_pointer_cast<CCodec::CDecoder>(decoder_ptr);
+  if (!c_decoder || get_frame_size(c_decoder->GetOutputFormat()) == 0)
+    return nullptr;
+
+  auto stream =
+      ampoolshared(eMemoryPoolKind_Codec, CodecStream, c_decoder, *config);
+  if (!stream->IsValid())
+    return nullptr;
+
+  stream->Refill();
+
+  return reinterpret_cast<am_codec_stream_handle>(
+      STORE_SHARED_PTR(CodecStream, stream));
+}
+
+void am_codec_stream_destroy(am_codec_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return;
+
+  stream_ptr->Close();
+  REMOVE_SHARED_PTR(CodecStream, stream);
+}
+
+am_uint64 am_codec_stream_read(am_codec_stream_handle stream, am_voidptr dst,
+                               am_uint64 frames) {
+  AM_STATS_SCOPE(codec);
+  if (!stream || !dst)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->Read(dst, frames);
+}
+
+am_uint64 am_codec_stream_refill(am_codec_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  AM_TRACE_SCOPE("codec.stream_refill");
+
+  if (!stream)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->Refill();
+}
+
+am_bool am_codec_stream_seek(am_codec_stream_handle stream, am_uint64 frame) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return AM_FALSE;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return AM_FALSE;
+
+  return BOOL_TO_AM_BOOL(stream_ptr->Seek(frame));
+}
+
+am_uint64 am_codec_stream_get_available(am_codec_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->GetAvailable();
+}
+
+am_uint64 am_codec_stream_get_position(am_codec_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return 0;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return 0;
+
+  return stream_ptr->GetPosition();
+}
+
+am_bool am_codec_stream_is_finished(am_codec_stream_handle stream) {
+  AM_STATS_SCOPE(codec);
+  if (!stream)
+    return AM_TRUE;
+
+  auto stream_ptr = GET_SHARED_PTR(CodecStream, stream);
+  if (!stream_ptr)
+    return AM_TRUE;
+
+  return BOOL_TO_AM_BOOL(stream_ptr->IsFinished());
+}
+
+} // extern "C"
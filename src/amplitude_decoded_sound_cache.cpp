@@ -0,0 +1,182 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "amplitude_decoded_sound_cache.h"
+
+DecodedSoundCache &DecodedSoundCache::Instance() {
+  static DecodedSoundCache instance;
+  return instance;
+}
+
+AmSize DecodedSoundCache::KeyHash::operator()(const Key &key) const {
+  AmSize hash = std::hash<AmOsString>{}(key.path);
+  const auto combine = [&hash](AmSize value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+
+  combine(std::hash<AmString>{}(key.codec));
+  combine(key.sample_rate);
+  combine(key.num_channels);
+  combine(key.bits_per_sample);
+  combine(static_cast<AmSize>(key.sample_type));
+
+  return hash;
+}
+
+AmOsString DecodedSoundCache::MakePinKey(const AmOsString &path,
+                                         const AmString &codec) {
+  AmOsString result = path;
+  result.push_back('\0');
+  result.append(codec.begin(), codec.end());
+  return result;
+}
+
+bool DecodedSoundCache::IsEnabled() const {
+  std::lock_guard lock(_mutex);
+  return _stats.capacity > 0;
+}
+
+bool DecodedSoundCache::Fetch(const Key &key, AmVoidPtr out,
+                              AmUInt64 &frames) {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _index.find(key);
+  if (it == _index.end()) {
+    _stats.misses++;
+    return false;
+  }
+
+  // Move the entry to the front of the LRU list
+  _entries.splice(_entries.begin(), _entries, it->second);
+
+  std::memcpy(out, it->second->data, it->second->size);
+  frames = it->second->frames;
+
+  _stats.hits++;
+  return true;
+}
+
+void DecodedSoundCache::Insert(const Key &key, const void *data, AmSize size,
+                               AmUInt64 frames) {
+  std::lock_guard lock(_mutex);
+
+  if (size == 0 || _index.contains(key) || !MakeRoom(size))
+    return;
+
+  auto *copy = ampoolmalloc(eMemoryPoolKind_SoundData, size);
+  if (!copy)
+    return;
+
+  std::memcpy(copy, data, size);
+
+  const bool pinned = _pinned.contains(MakePinKey(key.path, key.codec));
+  _entries.push_front({key, copy, size, frames, pinned});
+  _index.emplace(key, _entries.begin());
+
+  _stats.used_bytes += size;
+  _stats.entries = _entries.size();
+}
+
+void DecodedSoundCache::SetCapacity(AmSize capacity) {
+  std::lock_guard lock(_mutex);
+
+  _stats.capacity = capacity;
+  MakeRoom(0);
+}
+
+void DecodedSoundCache::Pin(const AmOsString &path, const AmString &codec) {
+  std::lock_guard lock(_mutex);
+
+  _pinned.insert(MakePinKey(path, codec));
+
+  for (auto &entry : _entries)
+    if (entry.key.path == path && entry.key.codec == codec)
+      entry.pinned = true;
+}
+
+void DecodedSoundCache::Unpin(const AmOsString &path, const AmString &codec) {
+  std::lock_guard lock(_mutex);
+
+  _pinned.erase(MakePinKey(path, codec));
+
+  for (auto &entry : _entries)
+    if (entry.key.path == path && entry.key.codec == codec)
+      entry.pinned = false;
+
+  // Pinned entries may have kept the cache over its capacity
+  MakeRoom(0);
+}
+
+void DecodedSoundCache::Clear() {
+  std::lock_guard lock(_mutex);
+
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    auto current = it++;
+    if (!current->pinned)
+      Evict(current);
+  }
+}
+
+void DecodedSoundCache::Shutdown() {
+  std::lock_guard lock(_mutex);
+
+  while (!_entries.empty())
+    Evict(_entries.begin());
+
+  _pinned.clear();
+}
+
+DecodedSoundCache::Stats DecodedSoundCache::GetStats() const {
+  std::lock_guard lock(_mutex);
+  return _stats;
+}
+
+void DecodedSoundCache::ResetStats() {
+  std::lock_guard lock(_mutex);
+
+  _stats.hits = 0;
+  _stats.misses = 0;
+  _stats.evictions = 0;
+}
+
+void DecodedSoundCache::Evict(std::list<Entry>::iterator it) {
+  ampoolfree(eMemoryPoolKind_SoundData, it->data);
+
+  _stats.used_bytes -= it->size;
+  _index.erase(it->key);
+  _entries.erase(it);
+
+  _stats.entries = _entries.size();
+}
+
+bool DecodedSoundCache::MakeRoom(AmSize size) {
+  if (size > _stats.capacity)
+    return false;
+
+  // Walk from the least recently used entry, skipping pinned ones
+  auto it = _entries.end();
+  while (_stats.used_bytes + size > _stats.capacity &&
+         it != _entries.begin()) {
+    auto current = std::prev(it);
+    if (current->pinned) {
+      it = current;
+      continue;
+    }
+
+    Evict(current);
+    _stats.evictions++;
+  }
+
+  return _stats.used_bytes + size <= _stats.capacity;
+}
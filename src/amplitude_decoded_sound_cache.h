@@ -0,0 +1,164 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_DECODED_SOUND_CACHE_H
+#define _AM_DECODED_SOUND_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+/**
+ * @brief LRU cache of fully decoded sounds.
+ *
+ * Entries are keyed by the path of the decoded file, the name of the codec and
+ * the output format, and are stored in the sound data memory pool. The cache is
+ * bounded in bytes, and pinned sounds are never evicted.
+ */
+class DecodedSoundCache
+{
+public:
+    /**
+     * @brief Identifies a decoded sound.
+     */
+    struct Key
+    {
+        AmOsString path;
+        AmString codec;
+        AmUInt32 sample_rate;
+        AmUInt16 num_channels;
+        AmUInt32 bits_per_sample;
+        eAudioSampleFormat sample_type;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    /**
+     * @brief Cache usage counters.
+     */
+    struct Stats
+    {
+        AmUInt64 hits = 0;
+        AmUInt64 misses = 0;
+        AmUInt64 evictions = 0;
+        AmSize used_bytes = 0;
+        AmSize capacity = 0;
+        AmSize entries = 0;
+    };
+
+    DecodedSoundCache(const DecodedSoundCache&) = delete;
+    DecodedSoundCache& operator=(const DecodedSoundCache&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static DecodedSoundCache& Instance();
+
+    /**
+     * @brief Checks whether the cache can hold any entry.
+     */
+    [[nodiscard]] bool IsEnabled() const;
+
+    /**
+     * @brief Copies a cached sound into the given buffer.
+     *
+     * @param[in] key The key of the sound.
+     * @param[out] out The buffer to copy the decoded frames into.
+     * @param[out] frames The number of frames copied.
+     *
+     * @return Whether the sound was found in the cache.
+     */
+    bool Fetch(const Key& key, AmVoidPtr out, AmUInt64& frames);
+
+    /**
+     * @brief Stores a copy of a decoded sound, evicting the least recently used entries if needed.
+     *
+     * @param[in] key The key of the sound.
+     * @param[in] data The decoded frames.
+     * @param[in] size The size of the decoded frames, in bytes.
+     * @param[in] frames The number of decoded frames.
+     */
+    void Insert(const Key& key, const void* data, AmSize size, AmUInt64 frames);
+
+    /**
+     * @brief Sets the maximum number of bytes the cache can hold.
+     */
+    void SetCapacity(AmSize capacity);
+
+    /**
+     * @brief Marks all the sounds decoded from the given file with the given codec as never evictable.
+     */
+    void Pin(const AmOsString& path, const AmString& codec);
+
+    /**
+     * @brief Makes the sounds decoded from the given file with the given codec evictable again.
+     */
+    void Unpin(const AmOsString& path, const AmString& codec);
+
+    /**
+     * @brief Releases all the entries which are not pinned.
+     */
+    void Clear();
+
+    /**
+     * @brief Releases all the entries, pinned ones included, and forgets all the pins.
+     *
+     * Entries live in the sound data memory pool, so this must run before the memory
+     * manager is unloaded. The destructor does not release anything, since it runs after.
+     */
+    void Shutdown();
+
+    [[nodiscard]] Stats GetStats() const;
+
+    void ResetStats();
+
+private:
+    struct KeyHash
+    {
+        AmSize operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        AmVoidPtr data;
+        AmSize size;
+        AmUInt64 frames;
+        bool pinned;
+    };
+
+    DecodedSoundCache() = default;
+
+    static AmOsString MakePinKey(const AmOsString& path, const AmString& codec);
+
+    void Evict(std::list<Entry>::iterator it);
+    bool MakeRoom(AmSize size);
+
+    std::list<Entry> _entries; // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+    std::unordered_set<AmOsString> _pinned;
+
+    Stats _stats;
+
+    mutable std::mutex _mutex;
+};
+
+#endif // _AM_DECODED_SOUND_CACHE_H
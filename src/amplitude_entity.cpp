@@ -12,35 +12,174 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
 #include <amplitude_entity.h>
 
+#include "amplitude_capture.h"
+#include "amplitude_change_filter.h"
+#include "amplitude_entity_table.h"
+#include "amplitude_frame.h"
 #include "amplitude_internals.h"
+#include "amplitude_raycast_service.h"
+#include "amplitude_spatial.h"
+#include "amplitude_stats.h"
+#include "amplitude_velocity_tracker.h"
+
+static constexpr am_float32 kEpsilon = 1e-6f;
+
+// Inverse distance attenuation, clamped between the min and max distances
+static am_float32 distance_gain(am_float32 distance,
+                                const am_audibility_params &params) {
+  if (distance >= params.max_distance)
+    return 0.0f;
+
+  if (distance <= params.min_distance)
+    return 1.0f;
+
+  const am_float32 span = params.rolloff * (distance - params.min_distance);
+  return params.min_distance / std::max(params.min_distance + span, kEpsilon);
+}
+
+// Cardioid family pattern: omnidirectional at 0, figure-eight at 1, narrowed
+// by the sharpness exponent
+static am_float32 directivity_gain(am_float32 directivity, am_float32 sharpness,
+                                   am_float32 cos_angle) {
+  if (directivity <= 0.0f)
+    return 1.0f;
+
+  const am_float32 pattern = (1.0f - directivity) + directivity * cos_angle;
+  return std::pow(std::abs(pattern), sharpness);
+}
 
 extern "C" {
+am_entity_handle am_entity_create(am_entity_id id) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityCreate, id);
+
+  Entity e = amEngine->GetEntity(id);
+  if (!e.Valid())
+    e = amEngine->AddEntity(id);
+
+  if (!e.Valid())
+    return nullptr;
+
+  auto *entity = reinterpret_cast<am_entity_handle>(e.GetState());
+  EntityTable::Instance().Add(entity);
+  return entity;
+}
+
+void am_entity_destroy(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityDestroy, AM_CAPTURE_HANDLE(Entity, entity));
+
+  const Entity c(reinterpret_cast<EntityInternalState *>(entity));
+  if (!c.Valid())
+    return;
+
+  EntityTable::Instance().Remove(entity);
+  VelocityTracker::Entities().Reset(entity);
+  ChangeFilter::Instance().Forget(entity);
+  FrameSnapshot::Instance().Forget(entity);
+  RaycastService::Instance().Unregister(entity);
+  Capture::Forget(AM_CAPTURE_HANDLE(Entity, entity));
+
+  amEngine->RemoveEntity(c.GetId());
+}
+
+am_size am_entity_get_count(void) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE_CALL(EntityGetCount);
+  return EntityTable::Instance().GetCount();
+}
+
+am_size am_entity_get_all(am_entity_handle *out, am_size offset,
+                          am_size capacity) {
+  AM_STATS_SCOPE(entity);
+  if (!out)
+    return 0;
+
+  return EntityTable::Instance().Copy(out, offset, capacity);
+}
+
+void am_entity_for_each(am_entity_visitor visitor, am_voidptr user_data) {
+  AM_STATS_SCOPE(entity);
+  if (!visitor)
+    return;
+
+  EntityTable::Instance().ForEach(
+      [&](am_entity_handle entity) { visitor(entity, user_data); });
+}
+
 am_bool am_entity_is_valid(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityIsValid, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return BOOL_TO_AM_BOOL(c.Valid());
 }
 
 am_entity_id am_entity_get_id(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetId, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetId();
 }
 
 am_vec3 am_entity_get_velocity(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetVelocity, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   const auto &vec = c.GetVelocity();
   return from_cpp(vec);
 }
 
 void am_entity_set_location(am_entity_handle entity, am_vec3 location) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetLocation, AM_CAPTURE_HANDLE(Entity, entity), location);
+  if (FrameSnapshot::Instance().StageLocation(entity, location))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendLocation(entity, location))
+    return;
+
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetLocation(to_cpp(location));
 }
 
+void am_entity_set_location_at(am_entity_handle entity, am_vec3 location,
+                               am_time time) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetLocationAt, AM_CAPTURE_HANDLE(Entity, entity), location,
+             time);
+  VelocityTracker::Entities().Update(entity, location, time);
+  if (FrameSnapshot::Instance().StageLocation(entity, location))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendLocation(entity, location))
+    return;
+
+  const Entity c(reinterpret_cast<EntityInternalState *>(entity));
+  c.SetLocation(to_cpp(location));
+}
+
+am_vec3 am_entity_get_tracked_velocity(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetTrackedVelocity, AM_CAPTURE_HANDLE(Entity, entity));
+  return VelocityTracker::Entities().GetVelocity(entity);
+}
+
+void am_entity_reset_velocity_tracking(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityResetVelocityTracking, AM_CAPTURE_HANDLE(Entity, entity));
+  VelocityTracker::Entities().Reset(entity);
+}
+
 am_vec3 am_entity_get_location(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetLocation, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   const auto &vec = c.GetLocation();
   return from_cpp(vec);
@@ -48,23 +187,38 @@ am_vec3 am_entity_get_location(am_entity_handle entity) {
 
 void am_entity_set_orientation(am_entity_handle entity,
                                am_quaternion orientation) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetOrientation, AM_CAPTURE_HANDLE(Entity, entity),
+             orientation);
+  if (FrameSnapshot::Instance().StageOrientation(entity, orientation))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendOrientation(entity, orientation))
+    return;
+
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetOrientation(Orientation(to_cpp(orientation)));
 }
 
 am_vec3 am_entity_get_direction(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetDirection, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   const auto vec = c.GetDirection();
   return from_cpp(vec);
 }
 
 am_vec3 am_entity_get_up(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetUp, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   const auto vec = c.GetUp();
   return from_cpp(vec);
 }
 
 am_quaternion am_entity_get_orientation(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetOrientation, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   const auto &orientation = c.GetOrientation();
   return from_cpp(orientation.GetQuaternion());
@@ -72,37 +226,75 @@ am_quaternion am_entity_get_orientation(am_entity_handle entity) {
 
 void am_entity_set_obstruction(am_entity_handle entity,
                                am_float32 obstruction) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetObstruction, AM_CAPTURE_HANDLE(Entity, entity),
+             obstruction);
+  if (FrameSnapshot::Instance().StageObstruction(entity, obstruction))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendScalar(
+          entity, am_change_filter_field_obstruction, obstruction))
+    return;
+
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetObstruction(obstruction);
 }
 
 void am_entity_set_occlusion(am_entity_handle entity, am_float32 occlusion) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetOcclusion, AM_CAPTURE_HANDLE(Entity, entity), occlusion);
+  if (FrameSnapshot::Instance().StageOcclusion(entity, occlusion))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendScalar(
+          entity, am_change_filter_field_occlusion, occlusion))
+    return;
+
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetOcclusion(occlusion);
 }
 
 void am_entity_set_directivity(am_entity_handle entity, am_float32 directivity,
                                am_float32 sharpness) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetDirectivity, AM_CAPTURE_HANDLE(Entity, entity),
+             directivity, sharpness);
+  if (FrameSnapshot::Instance().StageDirectivity(entity, directivity,
+                                                 sharpness))
+    return;
+
+  if (!ChangeFilter::Instance().ShouldSendDirectivity(entity, directivity,
+                                                      sharpness))
+    return;
+
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetDirectivity(directivity, sharpness);
 }
 
 am_float32 am_entity_get_obstruction(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetObstruction, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetObstruction();
 }
 
 am_float32 am_entity_get_occlusion(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetOcclusion, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetOcclusion();
 }
 
 am_float32 am_entity_get_directivity(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetDirectivity, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetDirectivity();
 }
 
 am_float32 am_entity_get_directivity_sharpness(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetDirectivitySharpness, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetDirectivitySharpness();
 }
@@ -110,18 +302,102 @@ am_float32 am_entity_get_directivity_sharpness(am_entity_handle entity) {
 void am_entity_set_environment_factor(am_entity_handle entity,
                                       am_environment_id environment_id,
                                       am_float32 factor) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntitySetEnvironmentFactor, AM_CAPTURE_HANDLE(Entity, entity),
+             environment_id, factor);
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   c.SetEnvironmentFactor(environment_id, factor);
 }
 
 am_float32 am_entity_get_environment_factor(am_entity_handle entity,
                                             am_environment_id environment_id) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetEnvironmentFactor, AM_CAPTURE_HANDLE(Entity, entity),
+             environment_id);
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetEnvironmentFactor(environment_id);
 }
 
 am_uint64 am_entity_get_active_channel_count(am_entity_handle entity) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(EntityGetActiveChannelCount, AM_CAPTURE_HANDLE(Entity, entity));
   const Entity c(reinterpret_cast<EntityInternalState *>(entity));
   return c.GetActiveChannelCount();
 }
+
+am_size am_entity_compute_audibility(const am_entity_handle *entities,
+                                     am_size count,
+                                     am_listener_handle listener,
+                                     const am_audibility_params *params,
+                                     am_float32 *out_gain_estimates) {
+  AM_STATS_SCOPE(entity);
+  if (!entities || !params || !out_gain_estimates)
+    return 0;
+
+  const Listener l(reinterpret_cast<ListenerInternalState *>(listener));
+  if (!l.Valid()) {
+    std::fill_n(out_gain_estimates, count, 0.0f);
+    return 0;
+  }
+
+  const am_mat4 matrix = from_cpp(l.GetInverseMatrix());
+  const am_vec3 listener_location = from_cpp(l.GetLocation());
+  const am_float32 listener_directivity = l.GetDirectivity();
+  const am_float32 listener_sharpness = l.GetDirectivitySharpness();
+
+  constexpr am_size kChunkSize = 64;
+  am_vec3 locations[kChunkSize];
+  am_vec3 local[kChunkSize];
+  am_float32 distances[kChunkSize];
+
+  am_size audible = 0;
+
+  for (am_size base = 0; base < count; base += kChunkSize) {
+    const am_size n = std::min(kChunkSize, count - base);
+
+    for (am_size i = 0; i < n; ++i) {
+      const Entity e(
+          reinterpret_cast<EntityInternalState *>(entities[base + i]));
+      locations[i] = e.Valid() ? from_cpp(e.GetLocation()) : listener_location;
+    }
+
+    transform_points(matrix, locations, local, distances, nullptr, nullptr, n);
+
+    for (am_size i = 0; i < n; ++i) {
+      const Entity e(
+          reinterpret_cast<EntityInternalState *>(entities[base + i]));
+
+      am_float32 gain = e.Valid() ? distance_gain(distances[i], *params) : 0.0f;
+
+      if (gain > 0.0f) {
+        gain *= 1.0f - e.GetObstruction() * (1.0f - params->obstruction_gain);
+        gain *= 1.0f - e.GetOcclusion() * (1.0f - params->occlusion_gain);
+      }
+
+      // Directivity is undefined when the entity and the listener overlap
+      if (gain > 0.0f && distances[i] > kEpsilon) {
+        const am_float32 inv_distance = 1.0f / distances[i];
+
+        // Forward is -Z in listener space
+        gain *= directivity_gain(listener_directivity, listener_sharpness,
+                                 -local[i].z * inv_distance);
+
+        const am_vec3 direction = from_cpp(e.GetDirection());
+        const am_float32 cos_angle =
+            ((listener_location.x - locations[i].x) * direction.x +
+             (listener_location.y - locations[i].y) * direction.y +
+             (listener_location.z - locations[i].z) * direction.z) *
+            inv_distance;
+        gain *= directivity_gain(e.GetDirectivity(),
+                                 e.GetDirectivitySharpness(), cos_angle);
+      }
+
+      out_gain_estimates[base + i] = gain;
+      if (gain >= params->threshold && gain > 0.0f)
+        ++audible;
+    }
+  }
+
+  return audible;
+}
 }
@@ -0,0 +1,71 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include "amplitude_entity_table.h"
+
+EntityTable &EntityTable::Instance() {
+  static EntityTable table;
+  return table;
+}
+
+void EntityTable::Add(am_entity_handle entity) {
+  std::lock_guard lock(_mutex);
+
+  const auto [it, inserted] =
+      _sparse.try_emplace(entity, static_cast<am_uint32>(_dense.size()));
+  if (inserted)
+    _dense.push_back(entity);
+}
+
+bool EntityTable::Remove(am_entity_handle entity) {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _sparse.find(entity);
+  if (it == _sparse.end())
+    return false;
+
+  const am_uint32 index = it->second;
+  const am_entity_handle last = _dense.back();
+
+  _dense[index] = last;
+  _sparse[last] = index;
+
+  _dense.pop_back();
+  _sparse.erase(entity);
+  return true;
+}
+
+bool EntityTable::Contains(am_entity_handle entity) const {
+  std::lock_guard lock(_mutex);
+  return _sparse.contains(entity);
+}
+
+am_size EntityTable::GetCount() const {
+  std::lock_guard lock(_mutex);
+  return _dense.size();
+}
+
+am_size EntityTable::Copy(am_entity_handle *out, am_size offset,
+                          am_size capacity) const {
+  std::lock_guard lock(_mutex);
+
+  if (offset >= _dense.size())
+    return 0;
+
+  const am_size count = std::min<am_size>(capacity, _dense.size() - offset);
+  std::copy_n(_dense.begin() + offset, count, out);
+  return count;
+}
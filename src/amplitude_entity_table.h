@@ -0,0 +1,89 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_ENTITY_TABLE_H
+#define _AM_ENTITY_TABLE_H
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <amplitude_entity.h>
+
+/**
+ * @brief Sparse set of the entities created through the C API.
+ *
+ * Live handles are packed in a dense array, so they can be walked contiguously. Handles are engine
+ * pointers rather than small integers, so the sparse index is a map from handles to dense
+ * positions. Removing an entity moves the last handle into its position.
+ */
+class EntityTable
+{
+public:
+    EntityTable(const EntityTable&) = delete;
+    EntityTable& operator=(const EntityTable&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static EntityTable& Instance();
+
+    /**
+     * @brief Adds an entity to the table. Does nothing if it is already there.
+     */
+    void Add(am_entity_handle entity);
+
+    /**
+     * @brief Removes an entity from the table.
+     *
+     * @return Whether the entity was in the table.
+     */
+    bool Remove(am_entity_handle entity);
+
+    [[nodiscard]] bool Contains(am_entity_handle entity) const;
+
+    [[nodiscard]] am_size GetCount() const;
+
+    /**
+     * @brief Copies a range of the dense array.
+     *
+     * @return The number of handles copied.
+     */
+    am_size Copy(am_entity_handle* out, am_size offset, am_size capacity) const;
+
+    /**
+     * @brief Calls a function for each live entity, in dense order.
+     *
+     * The table is locked during the walk, so the function must not create or destroy entities.
+     */
+    template<typename Function>
+    void ForEach(Function&& function) const
+    {
+        std::lock_guard lock(_mutex);
+        for (am_entity_handle entity : _dense)
+            function(entity);
+    }
+
+private:
+    EntityTable() = default;
+
+    std::vector<am_entity_handle> _dense;
+    std::unordered_map<am_entity_handle, am_uint32> _sparse;
+
+    mutable std::mutex _mutex;
+};
+
+#endif // _AM_ENTITY_TABLE_H
@@ -16,16 +16,19 @@
 
 #include <amplitude_environment.h>
 
+#include "amplitude_capture.h"
 #include "amplitude_internals.h"
 
 extern "C" {
 am_bool am_environment_is_valid(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentIsValid, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   return BOOL_TO_AM_BOOL(c.Valid());
 }
 
 am_environment_id am_environment_get_id(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetId, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   return c.GetId();
@@ -33,12 +36,16 @@ am_environment_id am_environment_get_id(am_environment_handle environment) {
 
 void am_environment_set_location(am_environment_handle environment,
                                  am_vec3 location) {
+  AM_CAPTURE(EnvironmentSetLocation,
+             AM_CAPTURE_HANDLE(Environment, environment), location);
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   c.SetLocation(to_cpp(location));
 }
 
 am_vec3 am_environment_get_location(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetLocation,
+             AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const auto &vec = c.GetLocation();
@@ -47,6 +54,8 @@ am_vec3 am_environment_get_location(am_environment_handle environment) {
 
 void am_environment_set_orientation(am_environment_handle environment,
                                     am_quaternion orientation) {
+  AM_CAPTURE(EnvironmentSetOrientation,
+             AM_CAPTURE_HANDLE(Environment, environment), orientation);
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   c.SetOrientation(Orientation(to_cpp(orientation)));
@@ -54,6 +63,8 @@ void am_environment_set_orientation(am_environment_handle environment,
 
 am_quaternion
 am_environment_get_orientation(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetOrientation,
+             AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const auto &orientation = c.GetOrientation();
@@ -61,6 +72,8 @@ am_environment_get_orientation(am_environment_handle environment) {
 }
 
 am_vec3 am_environment_get_direction(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetDirection,
+             AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const auto vec = c.GetDirection();
@@ -68,6 +81,7 @@ am_vec3 am_environment_get_direction(am_environment_handle environment) {
 }
 
 am_vec3 am_environment_get_up(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetUp, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const auto vec = c.GetUp();
@@ -77,6 +91,8 @@ am_vec3 am_environment_get_up(am_environment_handle environment) {
 am_float32
 am_environment_get_factor_for_location(am_environment_handle environment,
                                        am_vec3 location) {
+  AM_CAPTURE(EnvironmentGetFactorForLocation,
+             AM_CAPTURE_HANDLE(Environment, environment), location);
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   return c.GetFactor(to_cpp(location));
@@ -85,6 +101,9 @@ am_environment_get_factor_for_location(am_environment_handle environment,
 am_float32
 am_environment_get_factor_for_entity(am_environment_handle environment,
                                      am_entity_handle entity) {
+  AM_CAPTURE(EnvironmentGetFactorForEntity,
+             AM_CAPTURE_HANDLE(Environment, environment),
+             AM_CAPTURE_HANDLE(Entity, entity));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const Entity e(reinterpret_cast<EntityInternalState *>(entity));
@@ -93,6 +112,8 @@ am_environment_get_factor_for_entity(am_environment_handle environment,
 
 void am_environment_set_effect_by_id(am_environment_handle environment,
                                      am_effect_id effect_id) {
+  AM_CAPTURE(EnvironmentSetEffectById,
+             AM_CAPTURE_HANDLE(Environment, environment), effect_id);
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   c.SetEffect(effect_id);
@@ -100,6 +121,9 @@ void am_environment_set_effect_by_id(am_environment_handle environment,
 
 void am_environment_set_effect_by_name(am_environment_handle environment,
                                        const char *effect_name) {
+  AM_CAPTURE(EnvironmentSetEffectByName,
+             AM_CAPTURE_HANDLE(Environment, environment),
+             CaptureString{effect_name});
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   c.SetEffect(AmString(effect_name));
@@ -107,6 +131,10 @@ void am_environment_set_effect_by_name(am_environment_handle environment,
 
 void am_environment_set_effect(am_environment_handle environment,
                                am_effect_handle effect) {
+  // Effects are assets, so they are recorded by identifier
+  AM_CAPTURE(EnvironmentSetEffect, AM_CAPTURE_HANDLE(Environment, environment),
+             effect ? reinterpret_cast<const Effect *>(effect)->GetId()
+                    : am_effect_id(0));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const Effect *e = reinterpret_cast<const Effect *>(effect);
@@ -114,6 +142,7 @@ void am_environment_set_effect(am_environment_handle environment,
 }
 
 am_effect_handle am_environment_get_effect(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetEffect, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   const Effect *effect = c.GetEffect();
@@ -122,6 +151,7 @@ am_effect_handle am_environment_get_effect(am_environment_handle environment) {
 
 void am_environment_set_zone(am_environment_handle environment,
                              am_zone_handle zone) {
+  AM_CAPTURE(EnvironmentSetZone, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
 
@@ -132,6 +162,7 @@ void am_environment_set_zone(am_environment_handle environment,
 }
 
 am_zone_handle am_environment_get_zone(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentGetZone, AM_CAPTURE_HANDLE(Environment, environment));
   const Environment c(
       reinterpret_cast<EnvironmentInternalState *>(environment));
   auto zone = c.GetZone();
@@ -0,0 +1,188 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <cmath>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "amplitude_capture.h"
+#include "amplitude_entity_table.h"
+#include "amplitude_environment_blender.h"
+#include "amplitude_internals.h"
+#include "amplitude_stats.h"
+
+EnvironmentBlender &EnvironmentBlender::Instance() {
+  static EnvironmentBlender blender;
+  return blender;
+}
+
+void EnvironmentBlender::SetConfig(const am_environment_blend_config &config) {
+  std::lock_guard lock(_mutex);
+  _config = config;
+  _config.min_delta = std::max(_config.min_delta, 0.0f);
+}
+
+am_environment_blend_config EnvironmentBlender::GetConfig() const {
+  std::lock_guard lock(_mutex);
+  return _config;
+}
+
+void EnvironmentBlender::Register(am_environment_handle environment) {
+  std::lock_guard lock(_mutex);
+
+  const auto [it, inserted] = _index.try_emplace(
+      environment, static_cast<am_uint32>(_environments.size()));
+
+  if (inserted)
+    _environments.push_back(environment);
+}
+
+void EnvironmentBlender::Unregister(am_environment_handle environment) {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _index.find(environment);
+  if (it == _index.end())
+    return;
+
+  // Keep the environments dense by moving the last one into the hole
+  const am_uint32 index = it->second;
+  const am_uint32 last = static_cast<am_uint32>(_environments.size() - 1);
+  if (index != last) {
+    _environments[index] = _environments[last];
+    _index[_environments[index]] = index;
+  }
+
+  _environments.pop_back();
+  _index.erase(it);
+
+  const Environment c(
+      reinterpret_cast<EnvironmentInternalState *>(environment));
+  if (!c.Valid())
+    return;
+
+  // Otherwise the entities would keep the last factors forever
+  const am_environment_id id = c.GetId();
+  EntityTable::Instance().ForEach([&](am_entity_handle entity) {
+    const Entity e(reinterpret_cast<EntityInternalState *>(entity));
+    if (e.Valid() && e.GetEnvironmentFactor(id) != 0.0f)
+      am_entity_set_environment_factor(entity, id, 0.0f);
+  });
+}
+
+am_size EnvironmentBlender::Update() {
+  std::lock_guard lock(_mutex);
+
+  _active.clear();
+  _ids.clear();
+
+  for (am_environment_handle environment : _environments) {
+    const Environment c(
+        reinterpret_cast<EnvironmentInternalState *>(environment));
+    if (!c.Valid())
+      continue;
+
+    _active.push_back(environment);
+    _ids.push_back(c.GetId());
+  }
+
+  if (_active.empty())
+    return 0;
+
+  _factors.resize(_active.size());
+  am_size sent = 0;
+
+  EntityTable::Instance().ForEach([&](am_entity_handle entity) {
+    const Entity e(reinterpret_cast<EntityInternalState *>(entity));
+    if (!e.Valid())
+      return;
+
+    am_float32 total = 0.0f;
+    for (size_t k = 0; k < _active.size(); ++k) {
+      const Environment c(
+          reinterpret_cast<EnvironmentInternalState *>(_active[k]));
+      _factors[k] = std::clamp(c.GetFactor(e), 0.0f, 1.0f);
+      total += _factors[k];
+    }
+
+    // Overlapping zones share the entity instead of stacking their effects
+    const am_float32 scale =
+        _config.normalize && total > 1.0f ? 1.0f / total : 1.0f;
+
+    for (size_t k = 0; k < _active.size(); ++k) {
+      const am_float32 factor = _factors[k] * scale;
+      const am_float32 current = e.GetEnvironmentFactor(_ids[k]);
+      if (factor == current)
+        continue;
+
+      // Always land on the ends of the range, so zones fade fully in and out
+      if (std::abs(factor - current) < _config.min_delta && factor != 0.0f &&
+          factor != 1.0f)
+        continue;
+
+      // Through the C API, so the capture sees it
+      am_entity_set_environment_factor(entity, _ids[k], factor);
+      ++sent;
+    }
+  });
+
+  return sent;
+}
+
+am_size EnvironmentBlender::GetEnvironmentCount() const {
+  std::lock_guard lock(_mutex);
+  return _environments.size();
+}
+
+extern "C" {
+void am_environment_blend_set_config(
+    const am_environment_blend_config *config) {
+  if (!config)
+    return;
+
+  AM_CAPTURE(EnvironmentBlendSetConfig, *config);
+  EnvironmentBlender::Instance().SetConfig(*config);
+}
+
+void am_environment_blend_get_config(am_environment_blend_config *config) {
+  AM_CAPTURE_CALL(EnvironmentBlendGetConfig);
+  if (config)
+    *config = EnvironmentBlender::Instance().GetConfig();
+}
+
+void am_environment_blend_register(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentBlendRegister,
+             AM_CAPTURE_HANDLE(Environment, environment));
+  if (environment)
+    EnvironmentBlender::Instance().Register(environment);
+}
+
+void am_environment_blend_unregister(am_environment_handle environment) {
+  AM_CAPTURE(EnvironmentBlendUnregister,
+             AM_CAPTURE_HANDLE(Environment, environment));
+  EnvironmentBlender::Instance().Unregister(environment);
+}
+
+am_size am_environment_blend_update(void) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE_CALL(EnvironmentBlendUpdate);
+  return EnvironmentBlender::Instance().Update();
+}
+
+am_size am_environment_blend_get_environment_count(void) {
+  AM_CAPTURE_CALL(EnvironmentBlendGetEnvironmentCount);
+  return EnvironmentBlender::Instance().GetEnvironmentCount();
+}
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#ifndef _AM_ENVIRONMENT_BLENDER_H
+#define _AM_ENVIRONMENT_BLENDER_H
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <amplitude_environment_blend.h>
+
+/**
+ * @brief Sets the environment factors of every live entity from the registered environments.
+ *
+ * Registered environments are kept in a dense array, indexed through a map from handles.
+ */
+class EnvironmentBlender
+{
+public:
+    EnvironmentBlender(const EnvironmentBlender&) = delete;
+    EnvironmentBlender& operator=(const EnvironmentBlender&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static EnvironmentBlender& Instance();
+
+    void SetConfig(const am_environment_blend_config& config);
+
+    [[nodiscard]] am_environment_blend_config GetConfig() const;
+
+    void Register(am_environment_handle environment);
+
+    void Unregister(am_environment_handle environment);
+
+    /**
+     * @brief Computes and sets the environment factors of every live entity.
+     *
+     * @return The number of factors sent to the engine.
+     */
+    am_size Update();
+
+    [[nodiscard]] am_size GetEnvironmentCount() const;
+
+private:
+    EnvironmentBlender() = default;
+
+    std::vector<am_environment_handle> _environments;
+    std::unordered_map<am_environment_handle, am_uint32> _index;
+
+    std::vector<am_environment_handle> _active; // Valid environments of the current update
+    std::vector<am_environment_id> _ids; // Indexed like _active
+    std::vector<am_float32> _factors; // Indexed like _active
+
+    am_environment_blend_config _config = { AM_TRUE, 0.001f };
+
+    mutable std::mutex _mutex;
+};
+
+#endif // _AM_ENVIRONMENT_BLENDER_H
@@ -18,6 +18,8 @@
 #include <amplitude_filesystem.h>
 
 #include "amplitude_internals.h"
+#include "amplitude_stats.h"
+#include "amplitude_trace.h"
 
 class CFile final : public SparkyStudios::Audio::Amplitude::File {
 public:
@@ -188,18 +190,22 @@ extern "C" {
 #endif
 
 am_file_config am_file_config_init_custom() {
+  AM_STATS_SCOPE(file);
   return {am_file_type_custom, nullptr, nullptr};
 }
 
 am_file_config am_file_config_init_disk() {
+  AM_STATS_SCOPE(file);
   return {am_file_type_disk, nullptr, nullptr};
 }
 
 am_file_config am_file_config_init_memory() {
+  AM_STATS_SCOPE(file);
   return {am_file_type_memory, nullptr, nullptr};
 }
 
 am_file_handle am_file_create(const am_file_config *config) {
+  AM_STATS_SCOPE(file);
   if (config->type == am_file_type_custom)
     return {am_file_type_custom, ampoolnew(eMemoryPoolKind_IO, CFile,
                                            config->v_table, config->user_data)};
@@ -214,6 +220,7 @@ am_file_handle am_file_create(const am_file_config *config) {
 }
 
 void am_file_destroy(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   if (handle.type == am_file_type_custom) {
     ampooldelete(eMemoryPoolKind_IO, CFile,
                  static_cast<CFile *>(handle.handle));
@@ -227,85 +234,107 @@ void am_file_destroy(am_file_handle handle) {
 }
 
 const am_oschar *am_file_get_path(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return am_allocate_osstring(static_cast<File *>(handle.handle)->GetPath());
 }
 
 am_uint8 am_file_read8(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Read8();
 }
 
 am_uint16 am_file_read16(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Read16();
 }
 
 am_uint32 am_file_read32(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Read32();
 }
 
 am_uint64 am_file_read64(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Read64();
 }
 
 const char *am_file_read_string(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return am_allocate_string(static_cast<File *>(handle.handle)->ReadString());
 }
 
 am_size am_file_write8(am_file_handle handle, am_uint8 value) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Write8(value);
 }
 
 am_size am_file_write16(am_file_handle handle, am_uint16 value) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Write16(value);
 }
 
 am_size am_file_write32(am_file_handle handle, am_uint32 value) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Write32(value);
 }
 
 am_size am_file_write64(am_file_handle handle, am_uint64 value) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->Write64(value);
 }
 
 am_size am_file_write_string(am_file_handle handle, const char *str) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(handle.handle)->WriteString(str);
 }
 
 am_bool am_file_eof(am_file_handle file) {
+  AM_STATS_SCOPE(file);
   return BOOL_TO_AM_BOOL(static_cast<File *>(file.handle)->Eof());
 }
 
 am_size am_file_read(am_file_handle file, am_uint8 *dst, am_size bytes) {
+  AM_STATS_SCOPE(file);
+  AM_TRACE_SCOPE("file.read");
   return static_cast<File *>(file.handle)->Read(dst, bytes);
 }
 
 am_size am_file_write(am_file_handle file, const am_uint8 *buffer,
                       am_size bytes) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(file.handle)->Write(buffer, bytes);
 }
 
 am_size am_file_length(am_file_handle file) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(file.handle)->Length();
 }
 
 void am_file_seek(am_file_handle file, am_size offset,
                   am_file_seek_origin origin) {
+  AM_STATS_SCOPE(file);
+  AM_TRACE_SCOPE("file.seek");
   static_cast<File *>(file.handle)
       ->Seek(offset, static_cast<eFileSeekOrigin>(origin));
 }
 
 am_size am_file_position(am_file_handle file) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(file.handle)->Position();
 }
 
 am_voidptr am_file_get_ptr(am_file_handle file) {
+  AM_STATS_SCOPE(file);
   return static_cast<File *>(file.handle)->GetPtr();
 }
 
 am_bool am_file_is_valid(am_file_handle handle) {
+  AM_STATS_SCOPE(file);
   return BOOL_TO_AM_BOOL(static_cast<File *>(handle.handle)->IsValid());
 }
 
 void am_file_close(am_file_handle file) {
+  AM_STATS_SCOPE(file);
   auto file_ptr = GET_SHARED_PTR(File, file.handle);
 
   if (file_ptr) {
@@ -315,28 +344,34 @@ void am_file_close(am_file_handle file) {
 }
 
 am_filesystem_config am_filesystem_config_init_custom() {
+  AM_STATS_SCOPE(filesystem);
   return {am_filesystem_type_custom, nullptr, nullptr};
 }
 
 am_filesystem_config am_filesystem_config_init_disk() {
+  AM_STATS_SCOPE(filesystem);
   return {am_filesystem_type_disk, nullptr, nullptr};
 }
 
 am_filesystem_config am_filesystem_config_init_package() {
+  AM_STATS_SCOPE(filesystem);
   return {am_filesystem_type_package, nullptr, nullptr};
 }
 
 #if AM_PLATFORM_ANDROID
 am_filesystem_config am_filesystem_config_init_android() {
+  AM_STATS_SCOPE(filesystem);
   return {am_filesystem_type_android, nullptr, nullptr};
 }
 #elif AM_PLATFORM_IOS
 am_filesystem_config am_filesystem_config_init_ios() {
+  AM_STATS_SCOPE(filesystem);
   return {am_filesystem_type_ios, nullptr, nullptr};
 }
 #endif
 
 am_filesystem_handle am_filesystem_create(const am_filesystem_config *config) {
+  AM_STATS_SCOPE(filesystem);
   if (config->type == am_filesystem_type_custom)
     return {am_filesystem_type_custom,
             ampoolnew(eMemoryPoolKind_IO, CFileSystem, config->v_table,
@@ -364,6 +399,7 @@ am_filesystem_handle am_filesystem_create(const am_filesystem_config *config) {
 }
 
 void am_filesystem_destroy(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
   if (filesystem.type == am_filesystem_type_custom) {
     ampooldelete(eMemoryPoolKind_IO, CFileSystem,
                  static_cast<CFileSystem *>(filesystem.handle));
@@ -389,34 +425,40 @@ void am_filesystem_destroy(am_filesystem_handle filesystem) {
 
 void am_filesystem_set_base_path(am_filesystem_handle filesystem,
                                  const am_oschar *base_path) {
+  AM_STATS_SCOPE(filesystem);
   static_cast<FileSystem *>(filesystem.handle)->SetBasePath(base_path);
 }
 
 const am_oschar *am_filesystem_get_base_path(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
   return am_allocate_osstring(
       static_cast<FileSystem *>(filesystem.handle)->GetBasePath());
 }
 
 const am_oschar *am_filesystem_resolve_path(am_filesystem_handle filesystem,
                                             const am_oschar *path) {
+  AM_STATS_SCOPE(filesystem);
   return am_allocate_osstring(
       static_cast<FileSystem *>(filesystem.handle)->ResolvePath(path));
 }
 
 am_bool am_filesystem_exists(am_filesystem_handle filesystem,
                              const am_oschar *path) {
+  AM_STATS_SCOPE(filesystem);
   return BOOL_TO_AM_BOOL(
       static_cast<FileSystem *>(filesystem.handle)->Exists(path));
 }
 
 am_bool am_filesystem_is_directory(am_filesystem_handle filesystem,
                                    const am_oschar *path) {
+  AM_STATS_SCOPE(filesystem);
   return BOOL_TO_AM_BOOL(
       static_cast<FileSystem *>(filesystem.handle)->IsDirectory(path));
 }
 
 const am_oschar *am_filesystem_join(am_filesystem_handle filesystem,
                                     const am_oschar **parts, am_size count) {
+  AM_STATS_SCOPE(filesystem);
   std::vector<AmOsString> cpp_parts(count);
   for (am_size i = 0; i < count; i++)
     cpp_parts[i] = parts[i];
@@ -428,6 +470,9 @@ const am_oschar *am_filesystem_join(am_filesystem_handle filesystem,
 am_file_handle am_filesystem_open_file(am_filesystem_handle filesystem,
                                        const am_oschar *path,
                                        am_file_open_mode mode) {
+  AM_STATS_SCOPE(filesystem);
+  AM_TRACE_SCOPE("file.open");
+
   const auto file = static_cast<FileSystem *>(filesystem.handle)
                         ->OpenFile(path, static_cast<eFileOpenMode>(mode));
 
@@ -443,25 +488,34 @@ am_file_handle am_filesystem_open_file(am_filesystem_handle filesystem,
 }
 
 void am_filesystem_start_open(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
+  AM_TRACE_SCOPE("filesystem.start_open");
   static_cast<FileSystem *>(filesystem.handle)->StartOpenFileSystem();
 }
 
 am_bool am_filesystem_try_finalize_open(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
+  AM_TRACE_SCOPE("filesystem.finalize_open");
   return BOOL_TO_AM_BOOL(static_cast<FileSystem *>(filesystem.handle)
                              ->TryFinalizeOpenFileSystem());
 }
 
 void am_filesystem_start_close(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
+  AM_TRACE_SCOPE("filesystem.start_close");
   static_cast<FileSystem *>(filesystem.handle)->StartCloseFileSystem();
 }
 
 am_bool am_filesystem_try_finalize_close(am_filesystem_handle filesystem) {
+  AM_STATS_SCOPE(filesystem);
+  AM_TRACE_SCOPE("filesystem.finalize_close");
   return BOOL_TO_AM_BOOL(static_cast<FileSystem *>(filesystem.handle)
                              ->TryFinalizeCloseFileSystem());
 }
 
 void am_filesystem_package_set_filesystem(am_filesystem_handle filesystem,
                                           am_filesystem_config *internal) {
+  AM_STATS_SCOPE(filesystem);
   if (filesystem.type != am_filesystem_type_package ||
       internal->type == am_filesystem_type_package)
     return;
@@ -0,0 +1,234 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_frame.h>
+
+#include "amplitude_capture.h"
+#include "amplitude_change_filter.h"
+#include "amplitude_frame.h"
+#include "amplitude_internals.h"
+
+void FrameSnapshot::Buffer::Clear() {
+  records.clear();
+  index.clear();
+}
+
+void FrameSnapshot::Buffer::Remove(const void *handle) {
+  const auto it = index.find(handle);
+  if (it == index.end())
+    return;
+
+  // Keep the records dense by moving the last one into the hole
+  const am_uint32 slot = it->second;
+  records[slot] = records.back();
+  index[records[slot].handle] = slot;
+
+  records.pop_back();
+  index.erase(handle);
+}
+
+FrameSnapshot::FrameSnapshot()
+    : _back(std::make_unique<Buffer>()), _front(std::make_unique<Buffer>()) {}
+
+FrameSnapshot &FrameSnapshot::Instance() {
+  static FrameSnapshot snapshot;
+  return snapshot;
+}
+
+void FrameSnapshot::SetEnabled(bool enabled) {
+  _enabled.store(enabled, std::memory_order_relaxed);
+
+  if (!enabled)
+    Commit();
+}
+
+FrameSnapshot::Record &FrameSnapshot::Back(const void *handle, bool listener) {
+  const auto [it, inserted] = _back->index.try_emplace(
+      handle, static_cast<am_uint32>(_back->records.size()));
+
+  if (inserted) {
+    Record record = {};
+    record.handle = handle;
+    record.listener = listener;
+    _back->records.push_back(record);
+  }
+
+  return _back->records[it->second];
+}
+
+template <typename Write>
+bool FrameSnapshot::Stage(const void *handle, bool listener, Field field,
+                          Write &&write) {
+  if (!IsEnabled())
+    return false;
+
+  std::lock_guard lock(_mutex);
+  Record &record = Back(handle, listener);
+  write(record);
+  record.written |= field;
+  return true;
+}
+
+bool FrameSnapshot::StageLocation(am_entity_handle entity,
+                                  const am_vec3 &location) {
+  return Stage(entity, false, kLocation,
+               [&](Record &record) { record.location = location; });
+}
+
+bool FrameSnapshot::StageLocation(am_listener_handle listener,
+                                  const am_vec3 &location) {
+  return Stage(listener, true, kLocation,
+               [&](Record &record) { record.location = location; });
+}
+
+bool FrameSnapshot::StageOrientation(am_entity_handle entity,
+                                     const am_quaternion &orientation) {
+  return Stage(entity, false, kOrientation,
+               [&](Record &record) { record.orientation = orientation; });
+}
+
+bool FrameSnapshot::StageOrientation(am_listener_handle listener,
+                                     const am_quaternion &orientation) {
+  return Stage(listener, true, kOrientation,
+               [&](Record &record) { record.orientation = orientation; });
+}
+
+bool FrameSnapshot::StageDirectivity(am_entity_handle entity,
+                                     am_float32 directivity,
+                                     am_float32 sharpness) {
+  return Stage(entity, false, kDirectivity, [&](Record &record) {
+    record.directivity = directivity;
+    record.sharpness = sharpness;
+  });
+}
+
+bool FrameSnapshot::StageDirectivity(am_listener_handle listener,
+                                     am_float32 directivity,
+                                     am_float32 sharpness) {
+  return Stage(listener, true, kDirectivity, [&](Record &record) {
+    record.directivity = directivity;
+    record.sharpness = sharpness;
+  });
+}
+
+bool FrameSnapshot::StageObstruction(am_entity_handle entity,
+                                     am_float32 obstruction) {
+  return Stage(entity, false, kObstruction,
+               [&](Record &record) { record.obstruction = obstruction; });
+}
+
+bool FrameSnapshot::StageOcclusion(am_entity_handle entity,
+                                   am_float32 occlusion) {
+  return Stage(entity, false, kOcclusion,
+               [&](Record &record) { record.occlusion = occlusion; });
+}
+
+void FrameSnapshot::Forget(const void *handle) {
+  // Waits for a commit which may be applying this object's writes
+  std::lock_guard commit_lock(_commit_mutex);
+  std::lock_guard lock(_mutex);
+
+  _back->Remove(handle);
+  _front->Remove(handle);
+}
+
+void FrameSnapshot::Apply(const Record &record) {
+  if (record.listener) {
+    const Listener c(static_cast<ListenerInternalState *>(
+        const_cast<void *>(record.handle)));
+
+    if (record.written & kLocation)
+      c.SetLocation(to_cpp(record.location));
+    if (record.written & kOrientation)
+      c.SetOrientation(Orientation(to_cpp(record.orientation)));
+    if (record.written & kDirectivity)
+      c.SetDirectivity(record.directivity, record.sharpness);
+
+    return;
+  }
+
+  const Entity c(
+      static_cast<EntityInternalState *>(const_cast<void *>(record.handle)));
+
+  // Writes still go through the change filter, so its cache stays in sync
+  // with the engine state
+  auto &filter = ChangeFilter::Instance();
+
+  if ((record.written & kLocation) &&
+      filter.ShouldSendLocation(record.handle, record.location))
+    c.SetLocation(to_cpp(record.location));
+  if ((record.written & kOrientation) &&
+      filter.ShouldSendOrientation(record.handle, record.orientation))
+    c.SetOrientation(Orientation(to_cpp(record.orientation)));
+  if ((record.written & kDirectivity) &&
+      filter.ShouldSendDirectivity(record.handle, record.directivity,
+                                   record.sharpness))
+    c.SetDirectivity(record.directivity, record.sharpness);
+  if ((record.written & kObstruction) &&
+      filter.ShouldSendScalar(record.handle,
+                              am_change_filter_field_obstruction,
+                              record.obstruction))
+    c.SetObstruction(record.obstruction);
+  if ((record.written & kOcclusion) &&
+      filter.ShouldSendScalar(record.handle, am_change_filter_field_occlusion,
+                              record.occlusion))
+    c.SetOcclusion(record.occlusion);
+}
+
+am_size FrameSnapshot::Commit() {
+  std::lock_guard commit_lock(_commit_mutex);
+
+  {
+    std::lock_guard lock(_mutex);
+    std::swap(_back, _front);
+  }
+
+  for (const Record &record : _front->records)
+    Apply(record);
+
+  const am_size count = _front->records.size();
+
+  // Keeps the allocations for the next frames
+  _front->Clear();
+  return count;
+}
+
+am_size FrameSnapshot::GetPendingCount() const {
+  std::lock_guard lock(_mutex);
+  return _back->records.size();
+}
+
+extern "C" {
+void am_frame_set_snapshot_mode(am_bool enabled) {
+  AM_CAPTURE(FrameSetSnapshotMode, enabled);
+  FrameSnapshot::Instance().SetEnabled(AM_BOOL_TO_BOOL(enabled));
+}
+
+am_bool am_frame_is_snapshot_mode(void) {
+  AM_CAPTURE_CALL(FrameIsSnapshotMode);
+  return BOOL_TO_AM_BOOL(FrameSnapshot::Instance().IsEnabled());
+}
+
+am_size am_frame_commit(void) {
+  AM_CAPTURE_CALL(FrameCommit);
+  return FrameSnapshot::Instance().Commit();
+}
+
+am_size am_frame_get_pending_count(void) {
+  AM_CAPTURE_CALL(FrameGetPendingCount);
+  return FrameSnapshot::Instance().GetPendingCount();
+}
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_FRAME_H
+#define _AM_FRAME_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <amplitude_entity.h>
+#include <amplitude_listener.h>
+
+/**
+ * @brief Double-buffered entity and listener writes, applied to the engine by am_frame_commit().
+ *
+ * Each buffer holds a dense array of records, one per written object, indexed through a map from
+ * handles. Records keep the last value of each field and a mask of the written fields. Setters
+ * write into the back buffer under a mutex; a commit swaps the back buffer pointer with the front
+ * one under the same mutex, then applies the front buffer without holding it.
+ *
+ * The Stage* functions return false when the snapshot mode is disabled, in which case the caller
+ * writes the engine state directly.
+ */
+class FrameSnapshot
+{
+public:
+    FrameSnapshot(const FrameSnapshot&) = delete;
+    FrameSnapshot& operator=(const FrameSnapshot&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static FrameSnapshot& Instance();
+
+    [[nodiscard]] bool IsEnabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void SetEnabled(bool enabled);
+
+    bool StageLocation(am_entity_handle entity, const am_vec3& location);
+    bool StageLocation(am_listener_handle listener, const am_vec3& location);
+
+    bool StageOrientation(am_entity_handle entity, const am_quaternion& orientation);
+    bool StageOrientation(am_listener_handle listener, const am_quaternion& orientation);
+
+    bool StageDirectivity(am_entity_handle entity, am_float32 directivity, am_float32 sharpness);
+    bool StageDirectivity(am_listener_handle listener, am_float32 directivity, am_float32 sharpness);
+
+    bool StageObstruction(am_entity_handle entity, am_float32 obstruction);
+    bool StageOcclusion(am_entity_handle entity, am_float32 occlusion);
+
+    /**
+     * @brief Drops the pending writes of an object, before it is removed from the engine.
+     *
+     * Waits for a running commit to finish, so the object is never written once this returns.
+     */
+    void Forget(const void* handle);
+
+    /**
+     * @brief Applies the writes staged since the last commit.
+     *
+     * @return The number of objects updated.
+     */
+    am_size Commit();
+
+    [[nodiscard]] am_size GetPendingCount() const;
+
+private:
+    enum Field : am_uint8
+    {
+        kLocation = 1 << 0,
+        kOrientation = 1 << 1,
+        kDirectivity = 1 << 2,
+        kObstruction = 1 << 3,
+        kOcclusion = 1 << 4,
+    };
+
+    struct Record
+    {
+        const void* handle;
+        bool listener;
+        am_uint8 written; // Mask of Field values
+        am_vec3 location;
+        am_quaternion orientation;
+        am_float32 directivity;
+        am_float32 sharpness;
+        am_float32 obstruction;
+        am_float32 occlusion;
+    };
+
+    struct Buffer
+    {
+        std::vector<Record> records;
+        std::unordered_map<const void*, am_uint32> index;
+
+        void Clear();
+        void Remove(const void* handle);
+    };
+
+    FrameSnapshot();
+
+    // Gets the record of an object in the back buffer, the mutex must be held
+    Record& Back(const void* handle, bool listener);
+
+    // Writes a field of an object into the back buffer
+    template<typename Write>
+    bool Stage(const void* handle, bool listener, Field field, Write&& write);
+
+    static void Apply(const Record& record);
+
+    std::unique_ptr<Buffer> _back;
+    std::unique_ptr<Buffer> _front;
+
+    std::atomic<bool> _enabled = false;
+
+    mutable std::mutex _mutex; // Guards _back and the swap
+    std::mutex _commit_mutex; // Serializes commits and forgets, guards _front, locked before _mutex
+};
+
+#endif // _AM_FRAME_H
@@ -130,6 +130,9 @@ to_cpp(const am_mat4& mat)
 
 #define GET_SHARED_PTR(type, handle) SharedPtrManager::Instance().Get<type>(reinterpret_cast<type*>(handle))
 
+#define GET_MANY_SHARED_PTR(type, handles, out, count)                                                                         \
+    SharedPtrManager::Instance().GetMany<type>(reinterpret_cast<type* const*>(handles), out, count)
+
 #define REMOVE_SHARED_PTR(type, handle) SharedPtrManager::Instance().Remove<type>(reinterpret_cast<type*>(handle))
 
 #define CREATE_SHARED_PTR(pool, type, ...) SharedPtrManager::Instance().Store<type>(ampoolshared(pool, type, __VA_ARGS__))
@@ -16,43 +16,92 @@
 
 #include <amplitude_listener.h>
 
+#include "amplitude_capture.h"
+#include "amplitude_frame.h"
 #include "amplitude_internals.h"
+#include "amplitude_spatial.h"
+#include "amplitude_stats.h"
+#include "amplitude_velocity_tracker.h"
 
 extern "C" {
 am_bool am_listener_is_valid(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerIsValid, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   return BOOL_TO_AM_BOOL(c.Valid());
 }
 
 am_listener_id am_listener_get_id(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetId, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   return c.GetId();
 }
 
 am_vec3 am_listener_get_velocity(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetVelocity, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto &vec = c.GetVelocity();
   return from_cpp(vec);
 }
 
 am_vec3 am_listener_get_location(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetLocation, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto &vec = c.GetLocation();
   return from_cpp(vec);
 }
 
 void am_listener_set_location(am_listener_handle listener, am_vec3 location) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerSetLocation, AM_CAPTURE_HANDLE(Listener, listener),
+             location);
+  if (FrameSnapshot::Instance().StageLocation(listener, location))
+    return;
+
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   c.SetLocation(to_cpp(location));
 }
 
+void am_listener_set_location_at(am_listener_handle listener, am_vec3 location,
+                                 am_time time) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerSetLocationAt, AM_CAPTURE_HANDLE(Listener, listener),
+             location, time);
+  VelocityTracker::Listeners().Update(listener, location, time);
+  if (FrameSnapshot::Instance().StageLocation(listener, location))
+    return;
+
+  const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
+  c.SetLocation(to_cpp(location));
+}
+
+am_vec3 am_listener_get_tracked_velocity(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetTrackedVelocity, AM_CAPTURE_HANDLE(Listener, listener));
+  return VelocityTracker::Listeners().GetVelocity(listener);
+}
+
+void am_listener_reset_velocity_tracking(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerResetVelocityTracking,
+             AM_CAPTURE_HANDLE(Listener, listener));
+  VelocityTracker::Listeners().Reset(listener);
+}
+
 am_vec3 am_listener_get_direction(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetDirection, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto vec = c.GetDirection();
   return from_cpp(vec);
 }
 
 am_vec3 am_listener_get_up(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetUp, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto vec = c.GetUp();
   return from_cpp(vec);
@@ -60,11 +109,19 @@ am_vec3 am_listener_get_up(am_listener_handle listener) {
 
 void am_listener_set_orientation(am_listener_handle listener,
                                  am_quaternion orientation) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerSetOrientation, AM_CAPTURE_HANDLE(Listener, listener),
+             orientation);
+  if (FrameSnapshot::Instance().StageOrientation(listener, orientation))
+    return;
+
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   c.SetOrientation(Orientation(to_cpp(orientation)));
 }
 
 am_quaternion am_listener_get_orientation(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetOrientation, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto &orientation = c.GetOrientation();
   return from_cpp(orientation.GetQuaternion());
@@ -72,23 +129,129 @@ am_quaternion am_listener_get_orientation(am_listener_handle listener) {
 
 void am_listener_set_directivity(am_listener_handle listener,
                                  am_float32 directivity, am_float32 sharpness) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerSetDirectivity, AM_CAPTURE_HANDLE(Listener, listener),
+             directivity, sharpness);
+  if (FrameSnapshot::Instance().StageDirectivity(listener, directivity,
+                                                 sharpness))
+    return;
+
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   c.SetDirectivity(directivity, sharpness);
 }
 
 am_float32 am_listener_get_directivity(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetDirectivity, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   return c.GetDirectivity();
 }
 
 am_float32 am_listener_get_directivity_sharpness(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetDirectivitySharpness,
+             AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   return c.GetDirectivitySharpness();
 }
 
 am_mat4 am_listener_get_inverse_matrix(am_listener_handle listener) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerGetInverseMatrix, AM_CAPTURE_HANDLE(Listener, listener));
   const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
   const auto &mat = c.GetInverseMatrix();
   return from_cpp(mat);
 }
+
+void am_listener_transform_points(am_listener_handle listener,
+                                  const am_vec3 *in_positions,
+                                  am_vec3 *out_positions, am_size count) {
+  AM_STATS_SCOPE(listener);
+  if (!in_positions || !out_positions)
+    return;
+
+  const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
+  transform_points(from_cpp(c.GetInverseMatrix()), in_positions, out_positions,
+                   nullptr, nullptr, nullptr, count);
+}
+
+void am_listener_get_spherical_positions(am_listener_handle listener,
+                                         const am_vec3 *in_positions,
+                                         am_float32 *out_distances,
+                                         am_float32 *out_azimuths,
+                                         am_float32 *out_elevations,
+                                         am_size count) {
+  AM_STATS_SCOPE(listener);
+  if (!in_positions)
+    return;
+
+  const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
+  transform_points(from_cpp(c.GetInverseMatrix()), in_positions, nullptr,
+                   out_distances, out_azimuths, out_elevations, count);
+}
+
+void am_listener_set_state(am_listener_handle listener, am_vec3 location,
+                           am_quaternion orientation, am_float32 directivity,
+                           am_float32 sharpness) {
+  AM_STATS_SCOPE(listener);
+  AM_CAPTURE(ListenerSetState, AM_CAPTURE_HANDLE(Listener, listener), location,
+             orientation, directivity, sharpness);
+  auto &snapshot = FrameSnapshot::Instance();
+  if (snapshot.IsEnabled()) {
+    snapshot.StageLocation(listener, location);
+    snapshot.StageOrientation(listener, orientation);
+    snapshot.StageDirectivity(listener, directivity, sharpness);
+    return;
+  }
+
+  const Listener c(reinterpret_cast<ListenerInternalState *>(listener));
+  c.SetLocation(to_cpp(location));
+  c.SetOrientation(Orientation(to_cpp(orientation)));
+  c.SetDirectivity(directivity, sharpness);
+}
+
+void am_listener_set_state_many(const am_listener_handle *listeners,
+                                const am_vec3 *locations,
+                                const am_quaternion *orientations,
+                                const am_float32 *directivities,
+                                const am_float32 *sharpnesses,
+                                am_mat4 *inverse_matrices, am_size count) {
+  AM_STATS_SCOPE(listener);
+  if (!listeners || !locations || !orientations)
+    return;
+
+  auto &snapshot = FrameSnapshot::Instance();
+
+  for (am_size i = 0; i < count; ++i) {
+    const Listener c(reinterpret_cast<ListenerInternalState *>(listeners[i]));
+
+    const am_float32 directivity =
+        directivities ? directivities[i] : c.GetDirectivity();
+    const am_float32 sharpness =
+        sharpnesses ? sharpnesses[i] : c.GetDirectivitySharpness();
+
+    // Recorded as one set_state call per listener, so replays don't need to
+    // know about the batch
+    AM_CAPTURE(ListenerSetState, AM_CAPTURE_HANDLE(Listener, listeners[i]),
+               locations[i], orientations[i], directivity, sharpness);
+
+    const Orientation orientation(to_cpp(orientations[i]));
+    const AmVector3 location = to_cpp(locations[i]);
+
+    if (snapshot.IsEnabled()) {
+      snapshot.StageLocation(listeners[i], locations[i]);
+      snapshot.StageOrientation(listeners[i], orientations[i]);
+      snapshot.StageDirectivity(listeners[i], directivity, sharpness);
+    } else {
+      c.SetLocation(location);
+      c.SetOrientation(orientation);
+      c.SetDirectivity(directivity, sharpness);
+    }
+
+    // The engine only refreshes the inverse matrix in its next update, so it
+    // is computed here the same way from the new state
+    if (inverse_matrices)
+      inverse_matrices[i] = from_cpp(orientation.GetLookAtMatrix(location));
+  }
+}
 }
@@ -16,6 +16,9 @@
 
 #include <amplitude_memory.h>
 
+#include "amplitude_decoded_sound_cache.h"
+#include "amplitude_seek_table.h"
+
 class CMemoryAllocator : public MemoryAllocator {
 public:
   CMemoryAllocator(const am_memory_allocator_vtable *v_table)
@@ -64,7 +67,14 @@ void am_memory_manager_initialize(const am_memory_allocator_vtable *config) {
   MemoryManager::Initialize(std::make_unique<CMemoryAllocator>(config));
 }
 
-void am_memory_manager_deinitialize() { MemoryManager::Deinitialize(); }
+void am_memory_manager_deinitialize() {
+  // Release what the bindings keep in the memory pools while the allocator is
+  // still there
+  DecodedSoundCache::Instance().Shutdown();
+  SeekTable::ClearAll();
+
+  MemoryManager::Deinitialize();
+}
 
 am_bool am_memory_manager_is_initialized() {
   return BOOL_TO_AM_BOOL(MemoryManager::IsInitialized());
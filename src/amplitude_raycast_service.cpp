@@ -0,0 +1,223 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "amplitude_capture.h"
+#include "amplitude_internals.h"
+#include "amplitude_raycast_service.h"
+#include "amplitude_stats.h"
+
+RaycastService &RaycastService::Instance() {
+  static RaycastService service;
+  return service;
+}
+
+void RaycastService::SetConfig(const am_raycast_service_config &config) {
+  std::lock_guard lock(_mutex);
+  _config = config;
+}
+
+void RaycastService::Register(am_entity_handle entity, am_float32 loudness) {
+  std::lock_guard lock(_mutex);
+
+  const auto [it, inserted] =
+      _index.try_emplace(entity, static_cast<am_uint32>(_entities.size()));
+
+  if (!inserted) {
+    _entities[it->second].loudness = loudness;
+    return;
+  }
+
+  Tracked tracked = {};
+  tracked.entity = entity;
+  tracked.loudness = loudness;
+  _entities.push_back(tracked);
+}
+
+void RaycastService::Unregister(am_entity_handle entity) {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _index.find(entity);
+  if (it == _index.end())
+    return;
+
+  // Keep the entities dense by moving the last one into the hole
+  const am_uint32 index = it->second;
+  const am_uint32 last = static_cast<am_uint32>(_entities.size() - 1);
+  if (index != last) {
+    _entities[index] = _entities[last];
+    _index[_entities[index].entity] = index;
+  }
+
+  _entities.pop_back();
+  _index.erase(it);
+}
+
+am_size RaycastService::Update(am_listener_handle listener,
+                               am_time delta_time) {
+  std::lock_guard lock(_mutex);
+
+  delta_time = std::max(delta_time, 0.0);
+  _time += delta_time;
+
+  const Listener l(reinterpret_cast<ListenerInternalState *>(listener));
+  if (!l.Valid() || _entities.empty())
+    return 0;
+
+  const am_vec3 origin = from_cpp(l.GetLocation());
+  am_size cast = 0;
+
+  if (_config.callback && _config.max_rays_per_update > 0) {
+    _candidates.clear();
+    _priorities.resize(_entities.size());
+    _locations.resize(_entities.size());
+
+    for (am_uint32 i = 0; i < _entities.size(); ++i) {
+      const Tracked &tracked = _entities[i];
+      const Entity e(reinterpret_cast<EntityInternalState *>(tracked.entity));
+      if (!e.Valid())
+        continue;
+
+      const am_vec3 location = from_cpp(e.GetLocation());
+      const am_float32 dx = location.x - origin.x;
+      const am_float32 dy = location.y - origin.y;
+      const am_float32 dz = location.z - origin.z;
+      const am_float32 distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+      // Loud, close and stale entities first
+      _priorities[i] =
+          tracked.has_result
+              ? tracked.loudness *
+                    static_cast<float>(_time - tracked.last_cast_time) /
+                    (1.0f + distance)
+              : std::numeric_limits<float>::max();
+
+      _locations[i] = location;
+      _candidates.push_back(i);
+    }
+
+    cast = std::min<am_size>(_candidates.size(), _config.max_rays_per_update);
+
+    if (cast < _candidates.size()) {
+      std::nth_element(_candidates.begin(), _candidates.begin() + cast,
+                       _candidates.end(), [&](am_uint32 a, am_uint32 b) {
+                         return _priorities[a] > _priorities[b];
+                       });
+    }
+
+    _requests.resize(cast);
+    _results.assign(cast, {0.0f, 0.0f});
+
+    for (am_size k = 0; k < cast; ++k) {
+      const am_uint32 i = _candidates[k];
+      _requests[k] = {_entities[i].entity, origin, _locations[i]};
+    }
+
+    if (cast > 0) {
+      _config.callback(_requests.data(), _results.data(), cast,
+                       _config.user_data);
+    }
+
+    for (am_size k = 0; k < cast; ++k) {
+      Tracked &tracked = _entities[_candidates[k]];
+      tracked.target_obstruction =
+          std::clamp(_results[k].obstruction, 0.0f, 1.0f);
+      tracked.target_occlusion = std::clamp(_results[k].occlusion, 0.0f, 1.0f);
+      tracked.last_cast_time = _time;
+
+      // The first result is applied as is, there is nothing to fade from
+      if (!tracked.has_result) {
+        tracked.obstruction = tracked.target_obstruction;
+        tracked.occlusion = tracked.target_occlusion;
+        tracked.has_result = true;
+      }
+    }
+  }
+
+  // Frame rate independent exponential smoothing
+  const am_float32 alpha =
+      _config.smoothing_time > 0.0f
+          ? static_cast<am_float32>(
+                1.0 - std::exp(-delta_time / _config.smoothing_time))
+          : 1.0f;
+
+  for (Tracked &tracked : _entities) {
+    if (!tracked.has_result)
+      continue;
+
+    const Entity e(reinterpret_cast<EntityInternalState *>(tracked.entity));
+    if (!e.Valid())
+      continue;
+
+    tracked.obstruction +=
+        (tracked.target_obstruction - tracked.obstruction) * alpha;
+    tracked.occlusion += (tracked.target_occlusion - tracked.occlusion) * alpha;
+
+    // Through the C API, so the change filter, the snapshot mode and the
+    // capture all apply
+    am_entity_set_obstruction(tracked.entity, tracked.obstruction);
+    am_entity_set_occlusion(tracked.entity, tracked.occlusion);
+  }
+
+  return cast;
+}
+
+am_size RaycastService::GetEntityCount() const {
+  std::lock_guard lock(_mutex);
+  return _entities.size();
+}
+
+extern "C" {
+void am_raycast_service_set_config(const am_raycast_service_config *config) {
+  if (!config)
+    return;
+
+  // The callback can't be replayed, only the budget and smoothing are recorded
+  AM_CAPTURE(RaycastServiceSetConfig, config->max_rays_per_update,
+             config->smoothing_time);
+  RaycastService::Instance().SetConfig(*config);
+}
+
+void am_raycast_service_register_entity(am_entity_handle entity,
+                                        am_float32 loudness) {
+  AM_CAPTURE(RaycastServiceRegisterEntity, AM_CAPTURE_HANDLE(Entity, entity),
+             loudness);
+  if (entity)
+    RaycastService::Instance().Register(entity, loudness);
+}
+
+void am_raycast_service_unregister_entity(am_entity_handle entity) {
+  AM_CAPTURE(RaycastServiceUnregisterEntity,
+             AM_CAPTURE_HANDLE(Entity, entity));
+  RaycastService::Instance().Unregister(entity);
+}
+
+am_size am_raycast_service_update(am_listener_handle listener,
+                                  am_time delta_time) {
+  AM_STATS_SCOPE(entity);
+  AM_CAPTURE(RaycastServiceUpdate, AM_CAPTURE_HANDLE(Listener, listener),
+             delta_time);
+  return RaycastService::Instance().Update(listener, delta_time);
+}
+
+am_size am_raycast_service_get_entity_count(void) {
+  AM_CAPTURE_CALL(RaycastServiceGetEntityCount);
+  return RaycastService::Instance().GetEntityCount();
+}
+}
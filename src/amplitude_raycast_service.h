@@ -0,0 +1,88 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_RAYCAST_SERVICE_H
+#define _AM_RAYCAST_SERVICE_H
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <amplitude_raycast.h>
+
+/**
+ * @brief Schedules obstruction and occlusion rays on a budget, and smooths their results.
+ *
+ * Registered entities are kept in a dense array, indexed through a map from handles. The request
+ * and result arrays given to the callback are reused between updates.
+ */
+class RaycastService
+{
+public:
+    RaycastService(const RaycastService&) = delete;
+    RaycastService& operator=(const RaycastService&) = delete;
+
+    /**
+     * @brief Get the singleton instance.
+     */
+    static RaycastService& Instance();
+
+    void SetConfig(const am_raycast_service_config& config);
+
+    void Register(am_entity_handle entity, am_float32 loudness);
+
+    void Unregister(am_entity_handle entity);
+
+    /**
+     * @brief Casts the scheduled rays and applies the smoothed results.
+     *
+     * @return The number of rays cast.
+     */
+    am_size Update(am_listener_handle listener, am_time delta_time);
+
+    [[nodiscard]] am_size GetEntityCount() const;
+
+private:
+    struct Tracked
+    {
+        am_entity_handle entity;
+        am_float32 loudness;
+        am_float32 obstruction; // Applied values
+        am_float32 occlusion;
+        am_float32 target_obstruction; // Last results
+        am_float32 target_occlusion;
+        am_time last_cast_time;
+        bool has_result;
+    };
+
+    RaycastService() = default;
+
+    std::vector<Tracked> _entities;
+    std::unordered_map<am_entity_handle, am_uint32> _index;
+
+    std::vector<am_uint32> _candidates;
+    std::vector<float> _priorities; // Indexed like _entities
+    std::vector<am_vec3> _locations; // Indexed like _entities
+    std::vector<am_raycast_request> _requests;
+    std::vector<am_raycast_result> _results;
+
+    am_raycast_service_config _config = { nullptr, nullptr, 16, 0.1f };
+    am_time _time = 0.0;
+
+    mutable std::mutex _mutex;
+};
+
+#endif // _AM_RAYCAST_SERVICE_H
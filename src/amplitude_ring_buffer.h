@@ -0,0 +1,228 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_RING_BUFFER_H
+#define _AM_IMPLEMENTATION_RING_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+/**
+ * @brief Single-producer, single-consumer ring buffer of fixed-size frames.
+ *
+ * The read and write cursors are monotonically increasing frame counters, so
+ * the buffer never needs a separate "full" flag. Only the producer moves the
+ * write cursor and only the consumer moves the read cursor, which makes both
+ * sides lock-free.
+ */
+class SpscRingBuffer
+{
+public:
+    /**
+     * @brief Creates a ring buffer.
+     *
+     * @param[in] pool The memory pool to allocate the storage from.
+     * @param[in] capacity The maximum number of frames the buffer can hold.
+     * @param[in] stride The size in bytes of a single frame.
+     */
+    SpscRingBuffer(eMemoryPoolKind pool, AmUInt64 capacity, AmSize stride)
+        : _pool(pool)
+        , _capacity(capacity)
+        , _stride(stride)
+        , _data(nullptr)
+        , _read(0)
+        , _write(0)
+    {
+        if (_capacity > 0 && _stride > 0)
+            _data = static_cast<AmUInt8*>(ampoolmalign(_pool, _capacity * _stride, 16));
+    }
+
+    ~SpscRingBuffer()
+    {
+        if (_data)
+            ampoolfree(_pool, _data);
+
+        _data = nullptr;
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    /**
+     * @brief Checks whether the storage has been allocated.
+     */
+    [[nodiscard]] bool IsValid() const
+    {
+        return _data != nullptr;
+    }
+
+    [[nodiscard]] AmUInt64 GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    [[nodiscard]] AmSize GetStride() const
+    {
+        return _stride;
+    }
+
+    /**
+     * @brief Gets the base address of the storage.
+     */
+    [[nodiscard]] AmUInt8* GetData() const
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Gets the number of frames the consumer can read.
+     */
+    [[nodiscard]] AmUInt64 GetReadAvailable() const
+    {
+        return _write.load(std::memory_order_acquire) - _read.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of frames the producer can write.
+     */
+    [[nodiscard]] AmUInt64 GetWriteAvailable() const
+    {
+        return _capacity - (_write.load(std::memory_order_relaxed) - _read.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Gets the frame index in the storage at which the producer writes next.
+     */
+    [[nodiscard]] AmUInt64 GetWriteIndex() const
+    {
+        return _write.load(std::memory_order_relaxed) % _capacity;
+    }
+
+    /**
+     * @brief Gets the number of frames the producer can write without wrapping around.
+     */
+    [[nodiscard]] AmUInt64 GetContiguousWriteAvailable() const
+    {
+        return std::min(GetWriteAvailable(), _capacity - GetWriteIndex());
+    }
+
+    /**
+     * @brief Publishes frames written by the producer at the write index.
+     *
+     * @param[in] frames The number of frames written.
+     */
+    void CommitWrite(AmUInt64 frames)
+    {
+        _write.fetch_add(frames, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies frames into the buffer. Producer side only.
+     *
+     * @return The number of frames actually written.
+     */
+    AmUInt64 Write(const void* src, AmUInt64 frames)
+    {
+        frames = std::min(frames, GetWriteAvailable());
+        if (frames == 0)
+            return 0;
+
+        const AmUInt64 index = GetWriteIndex();
+        const AmUInt64 first = std::min(frames, _capacity - index);
+
+        std::memcpy(_data + index * _stride, src, first * _stride);
+        if (first < frames)
+            std::memcpy(_data, static_cast<const AmUInt8*>(src) + first * _stride, (frames - first) * _stride);
+
+        CommitWrite(frames);
+        return frames;
+    }
+
+    /**
+     * @brief Gets the frame index in the storage at which the consumer reads next.
+     */
+    [[nodiscard]] AmUInt64 GetReadIndex() const
+    {
+        return _read.load(std::memory_order_relaxed) % _capacity;
+    }
+
+    /**
+     * @brief Gets the number of frames the consumer can read without wrapping around.
+     */
+    [[nodiscard]] AmUInt64 GetContiguousReadAvailable() const
+    {
+        return std::min(GetReadAvailable(), _capacity - GetReadIndex());
+    }
+
+    /**
+     * @brief Releases frames read by the consumer at the read index.
+     *
+     * @param[in] frames The number of frames consumed.
+     */
+    void CommitRead(AmUInt64 frames)
+    {
+        _read.fetch_add(frames, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies frames out of the buffer. Consumer side only.
+     *
+     * @return The number of frames actually read.
+     */
+    AmUInt64 Read(void* dst, AmUInt64 frames)
+    {
+        frames = std::min(frames, GetReadAvailable());
+        if (frames == 0)
+            return 0;
+
+        const AmUInt64 index = GetReadIndex();
+        const AmUInt64 first = std::min(frames, _capacity - index);
+
+        std::memcpy(dst, _data + index * _stride, first * _stride);
+        if (first < frames)
+            std::memcpy(static_cast<AmUInt8*>(dst) + first * _stride, _data, (frames - first) * _stride);
+
+        CommitRead(frames);
+        return frames;
+    }
+
+    /**
+     * @brief Discards all the frames in the buffer.
+     *
+     * @warning Neither the producer nor the consumer must be active while resetting.
+     */
+    void Reset()
+    {
+        _read.store(0, std::memory_order_relaxed);
+        _write.store(0, std::memory_order_release);
+    }
+
+private:
+    eMemoryPoolKind _pool;
+    AmUInt64 _capacity;
+    AmSize _stride;
+    AmUInt8* _data;
+
+    alignas(64) std::atomic<AmUInt64> _read;
+    alignas(64) std::atomic<AmUInt64> _write;
+};
+
+#endif // _AM_IMPLEMENTATION_RING_BUFFER_H
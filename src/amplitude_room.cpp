@@ -16,6 +16,7 @@
 
 #include <amplitude_room.h>
 
+#include "amplitude_capture.h"
 #include "amplitude_internals.h"
 
 // Conversion functions for enum types
@@ -136,66 +137,78 @@ inline am_room_wall_material from_cpp(const RoomWallMaterial &material) {
 
 extern "C" {
 am_room_wall_material am_room_wall_material_create() {
+  AM_CAPTURE_CALL(RoomWallMaterialCreate);
   const RoomWallMaterial cpp_material;
   return from_cpp(cpp_material);
 }
 
 am_room_wall_material
 am_room_wall_material_create_with_type(am_room_wall_material_type type) {
+  AM_CAPTURE(RoomWallMaterialCreateWithType, type);
   const RoomWallMaterial cpp_material(to_cpp_material_type(type));
   return from_cpp(cpp_material);
 }
 
 am_bool am_room_is_valid(am_room_handle room) {
+  AM_CAPTURE(RoomIsValid, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   return BOOL_TO_AM_BOOL(c.Valid());
 }
 
 am_room_id am_room_get_id(am_room_handle room) {
+  AM_CAPTURE(RoomGetId, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   return c.GetId();
 }
 
 void am_room_set_location(am_room_handle room, am_vec3 location) {
+  AM_CAPTURE(RoomSetLocation, AM_CAPTURE_HANDLE(Room, room), location);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetLocation(to_cpp(location));
 }
 
 am_vec3 am_room_get_location(am_room_handle room) {
+  AM_CAPTURE(RoomGetLocation, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto &vec = c.GetLocation();
   return from_cpp(vec);
 }
 
 void am_room_set_orientation(am_room_handle room, am_quaternion orientation) {
+  AM_CAPTURE(RoomSetOrientation, AM_CAPTURE_HANDLE(Room, room), orientation);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetOrientation(Orientation(to_cpp(orientation)));
 }
 
 am_quaternion am_room_get_orientation(am_room_handle room) {
+  AM_CAPTURE(RoomGetOrientation, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto &orientation = c.GetOrientation();
   return from_cpp(orientation.GetQuaternion());
 }
 
 am_vec3 am_room_get_direction(am_room_handle room) {
+  AM_CAPTURE(RoomGetDirection, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto vec = c.GetDirection();
   return from_cpp(vec);
 }
 
 am_vec3 am_room_get_up(am_room_handle room) {
+  AM_CAPTURE(RoomGetUp, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto vec = c.GetUp();
   return from_cpp(vec);
 }
 
 void am_room_set_dimensions(am_room_handle room, am_vec3 dimensions) {
+  AM_CAPTURE(RoomSetDimensions, AM_CAPTURE_HANDLE(Room, room), dimensions);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetDimensions(to_cpp(dimensions));
 }
 
 void am_room_set_shape(am_room_handle room, am_box_shape_handle shape) {
+  AM_CAPTURE(RoomSetShape, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   // Cast the opaque handle to BoxShape pointer and dereference it
   const BoxShape *box_shape = reinterpret_cast<const BoxShape *>(shape);
@@ -205,6 +218,7 @@ void am_room_set_shape(am_room_handle room, am_box_shape_handle shape) {
 }
 
 am_box_shape_handle am_room_get_shape(am_room_handle room) {
+  AM_CAPTURE(RoomGetShape, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto &shape = c.GetShape();
   // Return a pointer to the shape - this is safe as long as the room remains
@@ -214,12 +228,15 @@ am_box_shape_handle am_room_get_shape(am_room_handle room) {
 
 void am_room_set_wall_material(am_room_handle room, am_room_wall wall,
                                am_room_wall_material material) {
+  AM_CAPTURE(RoomSetWallMaterial, AM_CAPTURE_HANDLE(Room, room), wall,
+             material);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetWallMaterial(to_cpp_wall(wall), to_cpp(material));
 }
 
 void am_room_set_all_wall_materials(am_room_handle room,
                                     am_room_wall_material material) {
+  AM_CAPTURE(RoomSetAllWallMaterials, AM_CAPTURE_HANDLE(Room, room), material);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetAllWallMaterials(to_cpp(material));
 }
@@ -231,6 +248,9 @@ void am_room_set_wall_materials(am_room_handle room,
                                 am_room_wall_material ceiling_material,
                                 am_room_wall_material front_wall_material,
                                 am_room_wall_material back_wall_material) {
+  AM_CAPTURE(RoomSetWallMaterials, AM_CAPTURE_HANDLE(Room, room),
+             left_wall_material, right_wall_material, floor_material,
+             ceiling_material, front_wall_material, back_wall_material);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetWallMaterials(to_cpp(left_wall_material), to_cpp(right_wall_material),
                      to_cpp(floor_material), to_cpp(ceiling_material),
@@ -239,33 +259,39 @@ void am_room_set_wall_materials(am_room_handle room,
 
 am_room_wall_material am_room_get_wall_material(am_room_handle room,
                                                 am_room_wall wall) {
+  AM_CAPTURE(RoomGetWallMaterial, AM_CAPTURE_HANDLE(Room, room), wall);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto &material = c.GetWallMaterial(to_cpp_wall(wall));
   return from_cpp(material);
 }
 
 void am_room_set_gain(am_room_handle room, am_float32 gain) {
+  AM_CAPTURE(RoomSetGain, AM_CAPTURE_HANDLE(Room, room), gain);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   c.SetGain(gain);
 }
 
 am_float32 am_room_get_gain(am_room_handle room) {
+  AM_CAPTURE(RoomGetGain, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   return c.GetGain();
 }
 
 am_float32 am_room_get_volume(am_room_handle room) {
+  AM_CAPTURE(RoomGetVolume, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   return c.GetVolume();
 }
 
 am_vec3 am_room_get_dimensions(am_room_handle room) {
+  AM_CAPTURE(RoomGetDimensions, AM_CAPTURE_HANDLE(Room, room));
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   const auto vec = c.GetDimensions();
   return from_cpp(vec);
 }
 
 am_float32 am_room_get_surface_area(am_room_handle room, am_room_wall wall) {
+  AM_CAPTURE(RoomGetSurfaceArea, AM_CAPTURE_HANDLE(Room, room), wall);
   const Room c(reinterpret_cast<RoomInternalState *>(room));
   return c.GetSurfaceArea(to_cpp_wall(wall));
 }
@@ -0,0 +1,387 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <amplitude_codec.h>
+
+#include "amplitude_sample_conversion.h"
+#include "amplitude_simd.h"
+
+static constexpr float kInt16ToFloat = 1.0f / 32768.0f;
+static constexpr float kFloatToInt16 = 32767.0f;
+static constexpr float kInt24ToFloat = 1.0f / 8388608.0f;
+static constexpr float kFloatToInt24 = 8388607.0f;
+static constexpr float kInt32ToFloat = 1.0f / 2147483648.0f;
+static constexpr float kFloatToInt32 = 2147483648.0f;
+
+// Largest float strictly lower than 2^31, so it converts to int32 safely
+static constexpr float kInt32Max = 2147483520.0f;
+
+static void int16_to_float32(const int16_t *src, float *dst, am_size count) {
+  am_size i = 0;
+
+#if AM_C_SIMD_AVX2
+  const __m256 scale = _mm256_set1_ps(kInt16ToFloat);
+  for (; i + 8 <= count; i += 8) {
+    const __m128i s =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    const __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(s));
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(f, scale));
+  }
+#elif AM_C_SIMD_SSE2
+  const __m128 scale = _mm_set1_ps(kInt16ToFloat);
+  for (; i + 8 <= count; i += 8) {
+    const __m128i s =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+  }
+#elif AM_C_SIMD_NEON
+  for (; i + 8 <= count; i += 8) {
+    const int16x8_t s = vld1q_s16(src + i);
+    const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+    const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+    vst1q_f32(dst + i, vmulq_n_f32(lo, kInt16ToFloat));
+    vst1q_f32(dst + i + 4, vmulq_n_f32(hi, kInt16ToFloat));
+  }
+#endif
+
+  for (; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * kInt16ToFloat;
+}
+
+static void float32_to_int16(const float *src, int16_t *dst, am_size count) {
+  am_size i = 0;
+
+#if AM_C_SIMD_AVX2
+  const __m256 scale = _mm256_set1_ps(kFloatToInt16);
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 minus_one = _mm256_set1_ps(-1.0f);
+  for (; i + 16 <= count; i += 16) {
+    __m256 a = _mm256_loadu_ps(src + i);
+    __m256 b = _mm256_loadu_ps(src + i + 8);
+    a = _mm256_mul_ps(_mm256_max_ps(_mm256_min_ps(a, one), minus_one), scale);
+    b = _mm256_mul_ps(_mm256_max_ps(_mm256_min_ps(b, one), minus_one), scale);
+    // packs works per 128-bit lane, restore the sample order afterwards
+    const __m256i packed =
+        _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                        _mm256_permute4x64_epi64(packed, 0xD8));
+  }
+#elif AM_C_SIMD_SSE2
+  const __m128 scale = _mm_set1_ps(kFloatToInt16);
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 minus_one = _mm_set1_ps(-1.0f);
+  for (; i + 8 <= count; i += 8) {
+    __m128 a = _mm_loadu_ps(src + i);
+    __m128 b = _mm_loadu_ps(src + i + 4);
+    a = _mm_mul_ps(_mm_max_ps(_mm_min_ps(a, one), minus_one), scale);
+    b = _mm_mul_ps(_mm_max_ps(_mm_min_ps(b, one), minus_one), scale);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(dst + i),
+        _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+  }
+#elif AM_C_SIMD_NEON
+  const float32x4_t one = vdupq_n_f32(1.0f);
+  const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+  for (; i + 8 <= count; i += 8) {
+    float32x4_t a = vld1q_f32(src + i);
+    float32x4_t b = vld1q_f32(src + i + 4);
+    a = vmulq_n_f32(vmaxq_f32(vminq_f32(a, one), minus_one), kFloatToInt16);
+    b = vmulq_n_f32(vmaxq_f32(vminq_f32(b, one), minus_one), kFloatToInt16);
+#if defined(__aarch64__) || defined(_M_ARM64)
+    const int32x4_t ia = vcvtnq_s32_f32(a);
+    const int32x4_t ib = vcvtnq_s32_f32(b);
+#else
+    const int32x4_t ia = vcvtq_s32_f32(a);
+    const int32x4_t ib = vcvtq_s32_f32(b);
+#endif
+    vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(ia), vqmovn_s32(ib)));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const float s = std::clamp(src[i], -1.0f, 1.0f);
+    dst[i] = static_cast<int16_t>(std::lrint(s * kFloatToInt16));
+  }
+}
+
+static void int32_to_float32(const int32_t *src, float *dst, am_size count) {
+  am_size i = 0;
+
+#if AM_C_SIMD_AVX2
+  const __m256 scale = _mm256_set1_ps(kInt32ToFloat);
+  for (; i + 8 <= count; i += 8) {
+    const __m256i s =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(s), scale));
+  }
+#elif AM_C_SIMD_SSE2
+  const __m128 scale = _mm_set1_ps(kInt32ToFloat);
+  for (; i + 4 <= count; i += 4) {
+    const __m128i s =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(s), scale));
+  }
+#elif AM_C_SIMD_NEON
+  for (; i + 4 <= count; i += 4) {
+    const float32x4_t f = vcvtq_f32_s32(vld1q_s32(src + i));
+    vst1q_f32(dst + i, vmulq_n_f32(f, kInt32ToFloat));
+  }
+#endif
+
+  for (; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * kInt32ToFloat;
+}
+
+static void float32_to_int32(const float *src, int32_t *dst, am_size count) {
+  am_size i = 0;
+
+#if AM_C_SIMD_AVX2
+  const __m256 scale = _mm256_set1_ps(kFloatToInt32);
+  const __m256 hi = _mm256_set1_ps(kInt32Max);
+  const __m256 lo = _mm256_set1_ps(-kFloatToInt32);
+  for (; i + 8 <= count; i += 8) {
+    __m256 s = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+    s = _mm256_max_ps(_mm256_min_ps(s, hi), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                        _mm256_cvtps_epi32(s));
+  }
+#elif AM_C_SIMD_SSE2
+  const __m128 scale = _mm_set1_ps(kFloatToInt32);
+  const __m128 hi = _mm_set1_ps(kInt32Max);
+  const __m128 lo = _mm_set1_ps(-kFloatToInt32);
+  for (; i + 4 <= count; i += 4) {
+    __m128 s = _mm_mul_ps(_mm_loadu_ps(src + i), scale);
+    s = _mm_max_ps(_mm_min_ps(s, hi), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_cvtps_epi32(s));
+  }
+#elif AM_C_SIMD_NEON
+  const float32x4_t hi = vdupq_n_f32(kInt32Max);
+  const float32x4_t lo = vdupq_n_f32(-kFloatToInt32);
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t s = vmulq_n_f32(vld1q_f32(src + i), kFloatToInt32);
+    s = vmaxq_f32(vminq_f32(s, hi), lo);
+#if defined(__aarch64__) || defined(_M_ARM64)
+    vst1q_s32(dst + i, vcvtnq_s32_f32(s));
+#else
+    vst1q_s32(dst + i, vcvtq_s32_f32(s));
+#endif
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const float s =
+        std::clamp(src[i] * kFloatToInt32, -kFloatToInt32, kInt32Max);
+    dst[i] = static_cast<int32_t>(std::lrint(s));
+  }
+}
+
+// Packed 24-bit samples have no natural vector layout, they stay scalar
+
+static void int24_to_float32(const uint8_t *src, float *dst, am_size count) {
+  for (am_size i = 0; i < count; ++i, src += 3) {
+    const uint32_t u = static_cast<uint32_t>(src[0]) |
+                       (static_cast<uint32_t>(src[1]) << 8) |
+                       (static_cast<uint32_t>(src[2]) << 16);
+    const int32_t v = static_cast<int32_t>(u << 8) >> 8;
+    dst[i] = static_cast<float>(v) * kInt24ToFloat;
+  }
+}
+
+static void float32_to_int24(const float *src, uint8_t *dst, am_size count) {
+  for (am_size i = 0; i < count; ++i, dst += 3) {
+    const float s = std::clamp(src[i], -1.0f, 1.0f);
+    const auto v = static_cast<int32_t>(std::lrint(s * kFloatToInt24));
+    dst[0] = static_cast<uint8_t>(v & 0xFF);
+    dst[1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+    dst[2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+  }
+}
+
+void convert_pcm_samples(const void *src, am_pcm_sample_type src_type,
+                         void *dst, am_pcm_sample_type dst_type,
+                         am_size count) {
+  if (src_type == dst_type) {
+    std::memcpy(dst, src, count * get_pcm_sample_size(src_type));
+    return;
+  }
+
+  if (dst_type == am_pcm_sample_type_float32) {
+    am_codec_samples_to_float32(src, src_type, static_cast<float *>(dst),
+                                count);
+    return;
+  }
+
+  if (src_type == am_pcm_sample_type_float32) {
+    am_codec_samples_from_float32(static_cast<const float *>(src), dst_type,
+                                  dst, count);
+    return;
+  }
+
+  // Integer to integer, through a float scratch buffer
+  constexpr am_size kChunkSize = 256;
+  float scratch[kChunkSize];
+
+  const auto *in = static_cast<const uint8_t *>(src);
+  auto *out = static_cast<uint8_t *>(dst);
+  const am_size src_size = get_pcm_sample_size(src_type);
+  const am_size dst_size = get_pcm_sample_size(dst_type);
+
+  for (am_size i = 0; i < count; i += kChunkSize) {
+    const am_size n = std::min(kChunkSize, count - i);
+    am_codec_samples_to_float32(in + i * src_size, src_type, scratch, n);
+    am_codec_samples_from_float32(scratch, dst_type, out + i * dst_size, n);
+  }
+}
+
+extern "C" {
+
+am_bool am_codec_samples_to_float32(const void *src, am_pcm_sample_type type,
+                                    am_float32 *dst, am_size count) {
+  if (!src || !dst)
+    return AM_FALSE;
+
+  switch (type) {
+  case am_pcm_sample_type_int16:
+    int16_to_float32(static_cast<const int16_t *>(src), dst, count);
+    return AM_TRUE;
+  case am_pcm_sample_type_int24:
+    int24_to_float32(static_cast<const uint8_t *>(src), dst, count);
+    return AM_TRUE;
+  case am_pcm_sample_type_int32:
+    int32_to_float32(static_cast<const int32_t *>(src), dst, count);
+    return AM_TRUE;
+  case am_pcm_sample_type_float32:
+    if (src != dst)
+      std::memcpy(dst, src, count * sizeof(float));
+    return AM_TRUE;
+  default:
+    return AM_FALSE;
+  }
+}
+
+am_bool am_codec_samples_from_float32(const am_float32 *src,
+                                      am_pcm_sample_type type, void *dst,
+                                      am_size count) {
+  if (!src || !dst)
+    return AM_FALSE;
+
+  switch (type) {
+  case am_pcm_sample_type_int16:
+    float32_to_int16(src, static_cast<int16_t *>(dst), count);
+    return AM_TRUE;
+  case am_pcm_sample_type_int24:
+    float32_to_int24(src, static_cast<uint8_t *>(dst), count);
+    return AM_TRUE;
+  case am_pcm_sample_type_int32:
+    float32_to_int32(src, static_cast<int32_t *>(dst), count);
+    return AM_TRUE;
+  case am_pcm_sample_type_float32:
+    if (src != dst)
+      std::memcpy(dst, src, count * sizeof(float));
+    return AM_TRUE;
+  default:
+    return AM_FALSE;
+  }
+}
+
+void am_codec_samples_interleave(const am_float32 *const *src,
+                                 am_float32 *dst, am_uint16 num_channels,
+                                 am_size frames) {
+  if (!src || !dst || num_channels == 0)
+    return;
+
+  am_size f = 0;
+
+  if (num_channels == 2) {
+    const float *l = src[0];
+    const float *r = src[1];
+
+#if AM_C_SIMD_AVX2 || AM_C_SIMD_SSE2
+    for (; f + 4 <= frames; f += 4) {
+      const __m128 a = _mm_loadu_ps(l + f);
+      const __m128 b = _mm_loadu_ps(r + f);
+      _mm_storeu_ps(dst + 2 * f, _mm_unpacklo_ps(a, b));
+      _mm_storeu_ps(dst + 2 * f + 4, _mm_unpackhi_ps(a, b));
+    }
+#elif AM_C_SIMD_NEON
+    for (; f + 4 <= frames; f += 4) {
+      float32x4x2_t v;
+      v.val[0] = vld1q_f32(l + f);
+      v.val[1] = vld1q_f32(r + f);
+      vst2q_f32(dst + 2 * f, v);
+    }
+#endif
+
+    for (; f < frames; ++f) {
+      dst[2 * f] = l[f];
+      dst[2 * f + 1] = r[f];
+    }
+
+    return;
+  }
+
+  for (; f < frames; ++f)
+    for (am_uint16 c = 0; c < num_channels; ++c)
+      dst[f * num_channels + c] = src[c][f];
+}
+
+void am_codec_samples_deinterleave(const am_float32 *src,
+                                   am_float32 *const *dst,
+                                   am_uint16 num_channels, am_size frames) {
+  if (!src || !dst || num_channels == 0)
+    return;
+
+  am_size f = 0;
+
+  if (num_channels == 2) {
+    float *l = dst[0];
+    float *r = dst[1];
+
+#if AM_C_SIMD_AVX2 || AM_C_SIMD_SSE2
+    for (; f + 4 <= frames; f += 4) {
+      const __m128 a = _mm_loadu_ps(src + 2 * f);
+      const __m128 b = _mm_loadu_ps(src + 2 * f + 4);
+      _mm_storeu_ps(l + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+      _mm_storeu_ps(r + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#elif AM_C_SIMD_NEON
+    for (; f + 4 <= frames; f += 4) {
+      const float32x4x2_t v = vld2q_f32(src + 2 * f);
+      vst1q_f32(l + f, v.val[0]);
+      vst1q_f32(r + f, v.val[1]);
+    }
+#endif
+
+    for (; f < frames; ++f) {
+      l[f] = src[2 * f];
+      r[f] = src[2 * f + 1];
+    }
+
+    return;
+  }
+
+  for (; f < frames; ++f)
+    for (am_uint16 c = 0; c < num_channels; ++c)
+      dst[c][f] = src[f * num_channels + c];
+}
+
+} // extern "C"
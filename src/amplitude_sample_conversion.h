@@ -0,0 +1,88 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_SAMPLE_CONVERSION_H
+#define _AM_IMPLEMENTATION_SAMPLE_CONVERSION_H
+
+#include <amplitude_codec.h>
+
+/**
+ * @brief Gets the size in bytes of a single sample of the given type.
+ */
+inline am_size
+get_pcm_sample_size(am_pcm_sample_type type)
+{
+    switch (type)
+    {
+    case am_pcm_sample_type_int16:
+        return 2;
+    case am_pcm_sample_type_int24:
+        return 3;
+    case am_pcm_sample_type_int32:
+    case am_pcm_sample_type_float32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Gets the PCM sample type described by a sound format.
+ *
+ * Integer formats are told apart using the bits per sample.
+ *
+ * @return The sample type, or am_pcm_sample_type_unknown if the format is not supported.
+ */
+inline am_pcm_sample_type
+get_pcm_sample_type(am_audio_sample_format format, am_uint32 bits_per_sample)
+{
+    if (format == am_audio_sample_format_float32)
+        return bits_per_sample == 32 ? am_pcm_sample_type_float32 : am_pcm_sample_type_unknown;
+
+    if (format == am_audio_sample_format_int16)
+    {
+        switch (bits_per_sample)
+        {
+        case 16:
+            return am_pcm_sample_type_int16;
+        case 24:
+            return am_pcm_sample_type_int24;
+        case 32:
+            return am_pcm_sample_type_int32;
+        default:
+            return am_pcm_sample_type_unknown;
+        }
+    }
+
+    return am_pcm_sample_type_unknown;
+}
+
+/**
+ * @brief Converts samples between any two PCM sample types.
+ *
+ * Conversions between two integer types go through 32-bit float, in small
+ * chunks on the stack.
+ *
+ * @param[in] src The source samples.
+ * @param[in] src_type The type of the source samples.
+ * @param[out] dst The destination samples. Must not overlap the source.
+ * @param[in] dst_type The type of the destination samples.
+ * @param[in] count The number of samples to convert.
+ */
+void
+convert_pcm_samples(const void* src, am_pcm_sample_type src_type, void* dst, am_pcm_sample_type dst_type, am_size count);
+
+#endif // _AM_IMPLEMENTATION_SAMPLE_CONVERSION_H
@@ -0,0 +1,227 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include "amplitude_seek_table.h"
+
+static constexpr AmUInt8 kSeekTableMagic[4] = {'A', 'M', 'S', 'T'};
+static constexpr AmUInt32 kSeekTableVersion = 1;
+
+std::atomic<AmUInt64> SeekTable::s_interval = 16384;
+
+using SeekTableKey = std::pair<AmOsString, AmString>;
+
+struct SeekTableEntry {
+  std::shared_ptr<SeekTable> table;
+  std::list<SeekTableKey>::iterator lru;
+};
+
+// All the state below is guarded by g_seek_tables_mutex
+static std::mutex g_seek_tables_mutex;
+static std::map<SeekTableKey, SeekTableEntry> g_seek_tables;
+static std::list<SeekTableKey> g_seek_tables_lru; // Most recently used first
+static AmSize g_seek_tables_capacity = 256;
+
+// Releases the least recently used tables until the capacity is met. Tables
+// still used by a decoder are skipped.
+static void evict_seek_tables() {
+  auto it = g_seek_tables_lru.end();
+  while (g_seek_tables.size() > g_seek_tables_capacity &&
+         it != g_seek_tables_lru.begin()) {
+    auto current = std::prev(it);
+    const auto entry = g_seek_tables.find(*current);
+
+    if (entry->second.table.use_count() > 1) {
+      it = current;
+      continue;
+    }
+
+    g_seek_tables.erase(entry);
+    g_seek_tables_lru.erase(current);
+  }
+}
+
+template <typename T> static bool write_value(File *file, const T &value) {
+  return file->Write(reinterpret_cast<AmConstUInt8Buffer>(&value),
+                     sizeof(T)) == sizeof(T);
+}
+
+template <typename T> static bool read_value(File *file, T &value) {
+  return file->Read(reinterpret_cast<AmUInt8Buffer>(&value), sizeof(T)) ==
+         sizeof(T);
+}
+
+std::shared_ptr<SeekTable> SeekTable::Acquire(const AmOsString &path,
+                                              const AmString &codec) {
+  if (path.empty())
+    return ampoolshared(eMemoryPoolKind_Codec, SeekTable);
+
+  std::lock_guard lock(g_seek_tables_mutex);
+
+  SeekTableKey key = {path, codec};
+  const auto it = g_seek_tables.find(key);
+  if (it != g_seek_tables.end()) {
+    g_seek_tables_lru.splice(g_seek_tables_lru.begin(), g_seek_tables_lru,
+                             it->second.lru);
+    return it->second.table;
+  }
+
+  auto table = ampoolshared(eMemoryPoolKind_Codec, SeekTable);
+  g_seek_tables_lru.push_front(key);
+  g_seek_tables.emplace(std::move(key),
+                        SeekTableEntry{table, g_seek_tables_lru.begin()});
+
+  evict_seek_tables();
+  return table;
+}
+
+void SeekTable::ClearAll() {
+  std::lock_guard lock(g_seek_tables_mutex);
+
+  for (auto it = g_seek_tables.begin(); it != g_seek_tables.end();) {
+    if (it->second.table.use_count() > 1) {
+      ++it;
+      continue;
+    }
+
+    g_seek_tables_lru.erase(it->second.lru);
+    it = g_seek_tables.erase(it);
+  }
+}
+
+void SeekTable::SetCapacity(AmSize count) {
+  std::lock_guard lock(g_seek_tables_mutex);
+
+  g_seek_tables_capacity = count;
+  evict_seek_tables();
+}
+
+void SeekTable::SetInterval(AmUInt64 frames) {
+  s_interval.store(std::max<AmUInt64>(frames, 1), std::memory_order_relaxed);
+}
+
+void SeekTable::Record(AmUInt64 frame, AmUInt64 offset) {
+  const AmUInt64 interval = s_interval.load(std::memory_order_relaxed);
+  const auto by_frame = [](AmUInt64 value, const Point &point) {
+    return value < point.frame;
+  };
+
+  std::unique_lock lock(_mutex);
+
+  // Checkpoints can be recorded out of order after seeks, so check both
+  // neighbours of the insertion point
+  const auto next =
+      std::upper_bound(_points.begin(), _points.end(), frame, by_frame);
+
+  if (next != _points.begin() && frame - std::prev(next)->frame < interval)
+    return;
+
+  if (next != _points.end() && next->frame - frame < interval)
+    return;
+
+  _points.insert(next, {frame, offset});
+}
+
+bool SeekTable::FindNearest(AmUInt64 frame, Point &point) const {
+  std::shared_lock lock(_mutex);
+
+  const auto next = std::upper_bound(
+      _points.begin(), _points.end(), frame,
+      [](AmUInt64 value, const Point &p) { return value < p.frame; });
+
+  if (next == _points.begin())
+    return false;
+
+  point = *std::prev(next);
+  return true;
+}
+
+AmSize SeekTable::GetCount() const {
+  std::shared_lock lock(_mutex);
+  return _points.size();
+}
+
+bool SeekTable::Save(File *file) const {
+  if (!file)
+    return false;
+
+  std::shared_lock lock(_mutex);
+
+  const AmUInt64 count = _points.size();
+  if (file->Write(kSeekTableMagic, sizeof(kSeekTableMagic)) !=
+          sizeof(kSeekTableMagic) ||
+      !write_value(file, kSeekTableVersion) || !write_value(file, count))
+    return false;
+
+  for (const auto &point : _points)
+    if (!write_value(file, point.frame) || !write_value(file, point.offset))
+      return false;
+
+  return true;
+}
+
+bool SeekTable::Load(File *file) {
+  if (!file)
+    return false;
+
+  AmUInt8 magic[sizeof(kSeekTableMagic)];
+  AmUInt32 version = 0;
+  AmUInt64 count = 0;
+
+  if (file->Read(magic, sizeof(magic)) != sizeof(magic) ||
+      std::memcmp(magic, kSeekTableMagic, sizeof(magic)) != 0 ||
+      !read_value(file, version) || version != kSeekTableVersion ||
+      !read_value(file, count))
+    return false;
+
+  std::vector<Point> points;
+  points.reserve(static_cast<AmSize>(std::min<AmUInt64>(count, 1 << 20)));
+
+  for (AmUInt64 i = 0; i < count; ++i) {
+    Point point;
+    if (!read_value(file, point.frame) || !read_value(file, point.offset))
+      return false;
+
+    points.push_back(point);
+  }
+
+  const auto by_frame = [](const Point &a, const Point &b) {
+    return a.frame < b.frame;
+  };
+
+  std::sort(points.begin(), points.end(), by_frame);
+
+  std::unique_lock lock(_mutex);
+
+  std::vector<Point> merged;
+  merged.reserve(_points.size() + points.size());
+  std::merge(_points.begin(), _points.end(), points.begin(), points.end(),
+             std::back_inserter(merged), by_frame);
+
+  // Keep a single checkpoint per frame
+  merged.erase(std::unique(merged.begin(), merged.end(),
+                           [](const Point &a, const Point &b) {
+                             return a.frame == b.frame;
+                           }),
+               merged.end());
+
+  _points = std::move(merged);
+  return true;
+}
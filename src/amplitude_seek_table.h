@@ -0,0 +1,103 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_SEEK_TABLE_H
+#define _AM_IMPLEMENTATION_SEEK_TABLE_H
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+/**
+ * @brief Sorted list of (frame, byte offset) checkpoints of an encoded file.
+ *
+ * Checkpoints are recorded while a file is decoded, or loaded from a sidecar file,
+ * and let decoders resume close to a seek target instead of scanning from the start.
+ *
+ * Tables are shared by all the decoders of the same file and codec, and outlive them
+ * so that the first decoding pass benefits the next ones. Tables no decoder uses are
+ * kept in a least recently used order, and the oldest ones are released when there
+ * are more tables than the capacity.
+ */
+class SeekTable
+{
+public:
+    struct Point
+    {
+        AmUInt64 frame;
+        AmUInt64 offset;
+    };
+
+    /**
+     * @brief Gets the table of the given file for the given codec.
+     *
+     * Files without a path get a private table.
+     */
+    static std::shared_ptr<SeekTable> Acquire(const AmOsString& path, const AmString& codec);
+
+    /**
+     * @brief Releases all the tables which are not used by an opened decoder.
+     */
+    static void ClearAll();
+
+    /**
+     * @brief Sets the maximum number of tables kept, releasing the least recently used ones
+     * which are not used by an opened decoder.
+     */
+    static void SetCapacity(AmSize count);
+
+    /**
+     * @brief Sets the minimum number of frames between two recorded checkpoints.
+     */
+    static void SetInterval(AmUInt64 frames);
+
+    /**
+     * @brief Records a checkpoint, unless another one is closer than the interval.
+     */
+    void Record(AmUInt64 frame, AmUInt64 offset);
+
+    /**
+     * @brief Finds the last checkpoint at or before the given frame.
+     *
+     * @return Whether such a checkpoint exists.
+     */
+    bool FindNearest(AmUInt64 frame, Point& point) const;
+
+    [[nodiscard]] AmSize GetCount() const;
+
+    /**
+     * @brief Writes the table to the given file.
+     */
+    bool Save(File* file) const;
+
+    /**
+     * @brief Merges the checkpoints stored in the given file into the table.
+     */
+    bool Load(File* file);
+
+private:
+    std::vector<Point> _points; // Sorted by frame
+    mutable std::shared_mutex _mutex;
+
+    static std::atomic<AmUInt64> s_interval;
+};
+
+#endif // _AM_IMPLEMENTATION_SEEK_TABLE_H
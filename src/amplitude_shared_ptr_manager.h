@@ -123,6 +123,18 @@ public:
      */
     template<typename T> std::shared_ptr<T> Get(T * raw_ptr);
 
+    /**
+     * @brief Retrieve several shared_ptr objects under a single registry lock.
+     *
+     * @tparam T The type of objects to retrieve.
+     * @param[in] raw_ptrs The raw pointer handles.
+     * @param[out] out The retrieved shared_ptr objects, null for handles not found or of another type.
+     * @param[in] count The number of handles.
+     *
+     * @return The number of handles found.
+     */
+    template<typename T> size_t GetMany(T* const* raw_ptrs, std::shared_ptr<T>* out, size_t count);
+
     /**
      * @brief Remove a shared_ptr from storage.
      *
@@ -215,6 +227,29 @@ SharedPtrManager::Get(T* raw_ptr)
     return nullptr;
 }
 
+template<typename T> size_t
+SharedPtrManager::GetMany(T* const* raw_ptrs, std::shared_ptr<T>* out, size_t count)
+{
+    size_t found = 0;
+
+    std::shared_lock lock(_mutex);
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = nullptr;
+        if (!raw_ptrs[i])
+            continue;
+
+        auto it = _storage.find(raw_ptrs[i]);
+        if (it != _storage.end() && it->second.type == std::type_index(typeid(T)))
+        {
+            out[i] = std::static_pointer_cast<T>(it->second.ptr);
+            found++;
+        }
+    }
+
+    return found;
+}
+
 template<typename T> bool
 SharedPtrManager::Remove(T* raw_ptr)
 {
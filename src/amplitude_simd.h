@@ -0,0 +1,33 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_SIMD_H
+#define _AM_IMPLEMENTATION_SIMD_H
+
+// The widest instruction set enabled at compile time is used. There is no
+// runtime dispatch: build with -mavx2 (or /arch:AVX2) to get the AVX2 kernels.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AM_C_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AM_C_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define AM_C_SIMD_NEON 1
+#endif
+
+#endif // _AM_IMPLEMENTATION_SIMD_H
@@ -0,0 +1,168 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "amplitude_simd.h"
+#include "amplitude_spatial.h"
+
+// Writes the outputs of four points given in SoA form
+static void store_points(const float *x, const float *y, const float *z,
+                         am_vec3 *out, am_float32 *distances,
+                         am_float32 *azimuths, am_float32 *elevations,
+                         am_size count) {
+  for (am_size i = 0; i < count; ++i) {
+    if (out)
+      out[i] = {x[i], y[i], z[i]};
+
+    if (distances)
+      distances[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+
+    if (azimuths)
+      azimuths[i] = std::atan2(x[i], -z[i]);
+
+    if (elevations)
+      elevations[i] = std::atan2(y[i], std::sqrt(x[i] * x[i] + z[i] * z[i]));
+  }
+}
+
+void transform_points(const am_mat4 &matrix, const am_vec3 *in, am_vec3 *out,
+                      am_float32 *distances, am_float32 *azimuths,
+                      am_float32 *elevations, am_size count) {
+  const float *m = matrix.data;
+  const bool angles = azimuths || elevations;
+
+  am_size i = 0;
+
+#if AM_C_SIMD_AVX2 || AM_C_SIMD_SSE2
+  const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]),
+               m2 = _mm_set1_ps(m[2]), m4 = _mm_set1_ps(m[4]),
+               m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]),
+               m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]),
+               m10 = _mm_set1_ps(m[10]), m12 = _mm_set1_ps(m[12]),
+               m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]);
+
+  for (; i + 4 <= count; i += 4) {
+    const float *src = in[i].data;
+
+    // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+    const __m128 a = _mm_loadu_ps(src);
+    const __m128 b = _mm_loadu_ps(src + 4);
+    const __m128 c = _mm_loadu_ps(src + 8);
+
+    const __m128 x = _mm_shuffle_ps(
+        _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)),
+        _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 y = _mm_shuffle_ps(
+        _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+        _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 z = _mm_shuffle_ps(
+        _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+        _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+    const __m128 tx = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)),
+        _mm_add_ps(_mm_mul_ps(m8, z), m12));
+    const __m128 ty = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)),
+        _mm_add_ps(_mm_mul_ps(m9, z), m13));
+    const __m128 tz = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)),
+        _mm_add_ps(_mm_mul_ps(m10, z), m14));
+
+    if (out) {
+      const __m128 xy_lo = _mm_unpacklo_ps(tx, ty);
+      const __m128 xy_hi = _mm_unpackhi_ps(tx, ty);
+
+      // Back to x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+      const __m128 oa = _mm_shuffle_ps(
+          xy_lo, _mm_shuffle_ps(tz, tx, _MM_SHUFFLE(1, 1, 0, 0)),
+          _MM_SHUFFLE(2, 0, 1, 0));
+      const __m128 ob = _mm_shuffle_ps(
+          _mm_shuffle_ps(ty, tz, _MM_SHUFFLE(1, 1, 1, 1)), xy_hi,
+          _MM_SHUFFLE(1, 0, 2, 0));
+      const __m128 oc = _mm_shuffle_ps(
+          _mm_shuffle_ps(tz, tx, _MM_SHUFFLE(3, 3, 2, 2)),
+          _mm_shuffle_ps(ty, tz, _MM_SHUFFLE(3, 3, 3, 3)),
+          _MM_SHUFFLE(2, 0, 2, 0));
+
+      float *dst = out[i].data;
+      _mm_storeu_ps(dst, oa);
+      _mm_storeu_ps(dst + 4, ob);
+      _mm_storeu_ps(dst + 8, oc);
+    }
+
+    if (distances) {
+      const __m128 sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, tx),
+                                              _mm_mul_ps(ty, ty)),
+                                   _mm_mul_ps(tz, tz));
+      _mm_storeu_ps(distances + i, _mm_sqrt_ps(sq));
+    }
+
+    // There is no vector atan2, the angles are computed one by one
+    if (angles) {
+      float sx[4], sy[4], sz[4];
+      _mm_storeu_ps(sx, tx);
+      _mm_storeu_ps(sy, ty);
+      _mm_storeu_ps(sz, tz);
+      store_points(sx, sy, sz, nullptr, nullptr,
+                   azimuths ? azimuths + i : nullptr,
+                   elevations ? elevations + i : nullptr, 4);
+    }
+  }
+#elif AM_C_SIMD_NEON
+  for (; i + 4 <= count; i += 4) {
+    const float32x4x3_t p = vld3q_f32(in[i].data);
+
+    float32x4x3_t t;
+    t.val[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]),
+                                                   p.val[0], m[0]),
+                                       p.val[1], m[4]),
+                           p.val[2], m[8]);
+    t.val[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]),
+                                                   p.val[0], m[1]),
+                                       p.val[1], m[5]),
+                           p.val[2], m[9]);
+    t.val[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[14]),
+                                                   p.val[0], m[2]),
+                                       p.val[1], m[6]),
+                           p.val[2], m[10]);
+
+    if (out)
+      vst3q_f32(out[i].data, t);
+
+    float sx[4], sy[4], sz[4];
+    vst1q_f32(sx, t.val[0]);
+    vst1q_f32(sy, t.val[1]);
+    vst1q_f32(sz, t.val[2]);
+
+    if (distances || angles)
+      store_points(sx, sy, sz, nullptr, distances ? distances + i : nullptr,
+                   azimuths ? azimuths + i : nullptr,
+                   elevations ? elevations + i : nullptr, 4);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const am_vec3 p = in[i];
+    const float x = m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12];
+    const float y = m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13];
+    const float z = m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14];
+
+    store_points(&x, &y, &z, out ? out + i : nullptr,
+                 distances ? distances + i : nullptr,
+                 azimuths ? azimuths + i : nullptr,
+                 elevations ? elevations + i : nullptr, 1);
+  }
+}
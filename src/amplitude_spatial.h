@@ -0,0 +1,52 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_SPATIAL_H
+#define _AM_IMPLEMENTATION_SPATIAL_H
+
+#include <amplitude_common.h>
+
+/**
+ * @brief Transforms points by a 4x4 matrix, and optionally computes their spherical coordinates.
+ *
+ * The matrix is column-major, as returned by am_listener_get_inverse_matrix(), and points are
+ * transformed with w = 1. Spherical coordinates are computed in the transformed space, where
+ * forward is -Z, up is +Y and right is +X.
+ *
+ * Points are transformed four at a time with the widest SIMD instruction set enabled at compile
+ * time. Every output is optional.
+ *
+ * @param[in] matrix The transform matrix.
+ * @param[in] in The points to transform.
+ * @param[out] out The transformed points, or nullptr. Can be the same array as @c in.
+ * @param[out] distances The lengths of the transformed points, or nullptr.
+ * @param[out] azimuths The angles from the forward axis towards the right, in radians in the range
+ * [-PI, PI], or nullptr.
+ * @param[out] elevations The angles above the horizontal plane, in radians in the range
+ * [-PI/2, PI/2], or nullptr.
+ * @param[in] count The number of points.
+ */
+void
+transform_points(
+    const am_mat4& matrix,
+    const am_vec3* in,
+    am_vec3* out,
+    am_float32* distances,
+    am_float32* azimuths,
+    am_float32* elevations,
+    am_size count);
+
+#endif // _AM_IMPLEMENTATION_SPATIAL_H
@@ -0,0 +1,136 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <amplitude_stats.h>
+
+#include "amplitude_stats.h"
+
+#ifdef AM_C_ENABLE_STATS
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+
+// One cache line per family, so that families used by different threads do
+// not share their counters
+struct alignas(64) FamilyCounters {
+  std::atomic<std::uint64_t> calls;
+  std::atomic<std::uint64_t> total_ns;
+  std::atomic<std::uint64_t> max_ns;
+  std::atomic<std::uint64_t> histogram[AM_STATS_HISTOGRAM_BUCKETS];
+};
+
+static FamilyCounters g_counters[am_stats_family_max];
+
+thread_local std::uint32_t StatsScope::s_depth = 0;
+
+std::uint64_t StatsScope::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void StatsScope::Record(am_stats_family family, std::uint64_t duration) {
+  FamilyCounters &counters = g_counters[family];
+
+  const int bucket = std::min(static_cast<int>(std::bit_width(duration)) - 1,
+                              AM_STATS_HISTOGRAM_BUCKETS - 1);
+
+  counters.calls.fetch_add(1, std::memory_order_relaxed);
+  counters.total_ns.fetch_add(duration, std::memory_order_relaxed);
+  counters.histogram[std::max(bucket, 0)].fetch_add(1,
+                                                    std::memory_order_relaxed);
+
+  std::uint64_t max = counters.max_ns.load(std::memory_order_relaxed);
+  while (duration > max &&
+         !counters.max_ns.compare_exchange_weak(max, duration,
+                                                std::memory_order_relaxed))
+    ;
+}
+
+#endif // AM_C_ENABLE_STATS
+
+extern "C" {
+am_bool am_stats_is_available(void) {
+#ifdef AM_C_ENABLE_STATS
+  return AM_TRUE;
+#else
+  return AM_FALSE;
+#endif
+}
+
+am_bool am_stats_snapshot(am_stats *stats) {
+  if (!stats)
+    return AM_FALSE;
+
+  std::memset(stats, 0, sizeof(am_stats));
+
+#ifdef AM_C_ENABLE_STATS
+  for (int f = 0; f < am_stats_family_max; ++f) {
+    const FamilyCounters &counters = g_counters[f];
+    am_stats_family_stats &out = stats->families[f];
+
+    out.calls = counters.calls.load(std::memory_order_relaxed);
+    out.total_ns = counters.total_ns.load(std::memory_order_relaxed);
+    out.max_ns = counters.max_ns.load(std::memory_order_relaxed);
+
+    for (int b = 0; b < AM_STATS_HISTOGRAM_BUCKETS; ++b)
+      out.histogram[b] = counters.histogram[b].load(std::memory_order_relaxed);
+  }
+
+  return AM_TRUE;
+#else
+  return AM_FALSE;
+#endif
+}
+
+void am_stats_reset(void) {
+#ifdef AM_C_ENABLE_STATS
+  for (auto &counters : g_counters) {
+    counters.calls.store(0, std::memory_order_relaxed);
+    counters.total_ns.store(0, std::memory_order_relaxed);
+    counters.max_ns.store(0, std::memory_order_relaxed);
+
+    for (auto &bucket : counters.histogram)
+      bucket.store(0, std::memory_order_relaxed);
+  }
+#endif
+}
+
+const char *am_stats_get_family_name(am_stats_family family) {
+  switch (family) {
+  case am_stats_family_entity:
+    return "entity";
+  case am_stats_family_listener:
+    return "listener";
+  case am_stats_family_channel:
+    return "channel";
+  case am_stats_family_bus:
+    return "bus";
+  case am_stats_family_codec:
+    return "codec";
+  case am_stats_family_file:
+    return "file";
+  case am_stats_family_filesystem:
+    return "filesystem";
+  case am_stats_family_thread:
+    return "thread";
+  default:
+    return nullptr;
+  }
+}
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_STATS_H
+#define _AM_IMPLEMENTATION_STATS_H
+
+#ifdef AM_C_ENABLE_STATS
+
+#include <cstdint>
+
+#include <amplitude_stats.h>
+
+/**
+ * @brief Counts a C API call and records its duration, when it is the outermost call of the thread.
+ */
+class StatsScope
+{
+public:
+    explicit StatsScope(am_stats_family family)
+        : _family(family)
+        , _outermost(s_depth++ == 0)
+        , _start(_outermost ? Now() : 0)
+    {}
+
+    ~StatsScope()
+    {
+        --s_depth;
+        if (_outermost)
+            Record(_family, Now() - _start);
+    }
+
+    StatsScope(const StatsScope&) = delete;
+    StatsScope& operator=(const StatsScope&) = delete;
+
+    static std::uint64_t Now();
+    static void Record(am_stats_family family, std::uint64_t duration);
+
+private:
+    static thread_local std::uint32_t s_depth;
+
+    am_stats_family _family;
+    bool _outermost;
+    std::uint64_t _start;
+};
+
+#define AM_STATS_CONCAT_IMPL(a, b) a##b
+#define AM_STATS_CONCAT(a, b) AM_STATS_CONCAT_IMPL(a, b)
+#define AM_STATS_SCOPE(family) const StatsScope AM_STATS_CONCAT(_am_stats_scope_, __LINE__)(am_stats_family_##family)
+
+#else
+
+#define AM_STATS_SCOPE(family) ((void)0)
+
+#endif // AM_C_ENABLE_STATS
+
+#endif // _AM_IMPLEMENTATION_STATS_H
@@ -17,6 +17,8 @@
 #include <amplitude_thread.h>
 
 #include "amplitude_internals.h"
+#include "amplitude_stats.h"
+#include "amplitude_trace.h"
 
 class CPoolTask final : public Thread::PoolTask {
 public:
@@ -24,6 +26,7 @@ public:
       : _func(func), _param(param) {}
 
   void Work() override {
+    AM_TRACE_SCOPE("thread.task");
     _func(reinterpret_cast<am_thread_pool_task_handle>(this), _param);
   }
 
@@ -45,6 +48,7 @@ public:
       : _func(func), _param(param) {}
 
   void AwaitableWork() override {
+    AM_TRACE_SCOPE("thread.task");
     _func(reinterpret_cast<am_thread_pool_task_awaitable_handle>(this), _param);
   }
 
@@ -70,19 +74,33 @@ static std::unordered_map<CAwaitablePoolTask *,
 
 extern "C" {
 am_thread_handle am_thread_create(am_thread_proc func, am_voidptr param) {
+  AM_STATS_SCOPE(thread);
   return reinterpret_cast<am_thread_handle>(Thread::CreateThread(func, param));
 }
 
-void am_thread_sleep(am_int32 ms) { Thread::Sleep(ms); }
+void am_thread_sleep(am_int32 ms) {
+  AM_STATS_SCOPE(thread);
+  Thread::Sleep(ms);
+}
 
-void am_thread_wait(am_thread_handle thread) { Thread::Wait(thread); }
+void am_thread_wait(am_thread_handle thread) {
+  AM_STATS_SCOPE(thread);
+  Thread::Wait(thread);
+}
 
-void am_thread_release(am_thread_handle thread) { Thread::Release(thread); }
+void am_thread_release(am_thread_handle thread) {
+  AM_STATS_SCOPE(thread);
+  Thread::Release(thread);
+}
 
-am_thread_id am_thread_get_id() { return Thread::GetCurrentThreadId(); }
+am_thread_id am_thread_get_id() {
+  AM_STATS_SCOPE(thread);
+  return Thread::GetCurrentThreadId();
+}
 
 am_thread_pool_task_handle
 am_thread_pool_task_create(am_thread_pool_task_proc func, am_voidptr param) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_pool_mutex);
 
   auto task = AmSharedPtr<CPoolTask>::Make(func, param);
@@ -94,6 +112,7 @@ am_thread_pool_task_create(am_thread_pool_task_proc func, am_voidptr param) {
 am_thread_pool_task_awaitable_handle
 am_thread_pool_task_awaitable_create(am_thread_pool_task_awaitable_proc func,
                                      am_voidptr param) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_awaitable_pool_mutex);
 
   auto task = AmSharedPtr<CAwaitablePoolTask>::Make(func, param);
@@ -103,6 +122,7 @@ am_thread_pool_task_awaitable_create(am_thread_pool_task_awaitable_proc func,
 }
 
 void am_thread_pool_task_destroy(am_thread_pool_task_handle task) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_pool_mutex);
 
   auto *t = reinterpret_cast<CPoolTask *>(task);
@@ -111,6 +131,7 @@ void am_thread_pool_task_destroy(am_thread_pool_task_handle task) {
 
 void am_thread_pool_task_awaitable_destroy(
     am_thread_pool_task_awaitable_handle task) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_awaitable_pool_mutex);
 
   auto *t = reinterpret_cast<CAwaitablePoolTask *>(task);
@@ -118,34 +139,41 @@ void am_thread_pool_task_awaitable_destroy(
 }
 
 am_bool am_thread_pool_task_get_ready(am_thread_pool_task_handle task) {
+  AM_STATS_SCOPE(thread);
   return BOOL_TO_AM_BOOL(reinterpret_cast<CPoolTask *>(task)->Ready());
 }
 
 am_bool am_thread_pool_task_awaitable_get_ready(
     am_thread_pool_task_awaitable_handle task) {
+  AM_STATS_SCOPE(thread);
   return BOOL_TO_AM_BOOL(reinterpret_cast<CAwaitablePoolTask *>(task)->Ready());
 }
 
 void am_thread_pool_task_set_ready(am_thread_pool_task_handle task) {
+  AM_STATS_SCOPE(thread);
   reinterpret_cast<CPoolTask *>(task)->SetReady();
 }
 
 void am_thread_pool_task_awaitable_set_ready(
     am_thread_pool_task_awaitable_handle task) {
+  AM_STATS_SCOPE(thread);
   reinterpret_cast<CAwaitablePoolTask *>(task)->SetReady();
 }
 
 void am_thread_pool_task_awaitable_await(
     am_thread_pool_task_awaitable_handle task) {
+  AM_STATS_SCOPE(thread);
   reinterpret_cast<CAwaitablePoolTask *>(task)->Await();
 }
 
 void am_thread_pool_task_awaitable_await_for(
     am_thread_pool_task_awaitable_handle task, am_uint64 ms) {
+  AM_STATS_SCOPE(thread);
   reinterpret_cast<CAwaitablePoolTask *>(task)->Await(ms);
 }
 
 am_thread_pool_handle am_thread_pool_create(am_uint32 thread_count) {
+  AM_STATS_SCOPE(thread);
   auto *pool = amnew(Thread::Pool);
   pool->Init(thread_count);
 
@@ -153,11 +181,13 @@ am_thread_pool_handle am_thread_pool_create(am_uint32 thread_count) {
 }
 
 void am_thread_pool_destroy(am_thread_pool_handle pool) {
+  AM_STATS_SCOPE(thread);
   amdelete(Pool, reinterpret_cast<Thread::Pool *>(pool));
 }
 
 void am_thread_pool_add_task(am_thread_pool_handle pool,
                              am_thread_pool_task_handle task) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_pool_mutex);
 
   auto *t = reinterpret_cast<CPoolTask *>(task);
@@ -169,6 +199,7 @@ void am_thread_pool_add_task(am_thread_pool_handle pool,
 
 void am_thread_pool_add_task_awaitable(
     am_thread_pool_handle pool, am_thread_pool_task_awaitable_handle task) {
+  AM_STATS_SCOPE(thread);
   std::lock_guard lock(g_awaitable_pool_mutex);
 
   auto *t = reinterpret_cast<CAwaitablePoolTask *>(task);
@@ -179,14 +210,17 @@ void am_thread_pool_add_task_awaitable(
 }
 
 am_uint32 am_thread_pool_get_thread_count(am_thread_pool_handle pool) {
+  AM_STATS_SCOPE(thread);
   return reinterpret_cast<Thread::Pool *>(pool)->GetThreadCount();
 }
 
 am_bool am_thread_pool_is_running(am_thread_pool_handle pool) {
+  AM_STATS_SCOPE(thread);
   return reinterpret_cast<Thread::Pool *>(pool)->IsRunning();
 }
 
 am_bool am_thread_pool_has_tasks(am_thread_pool_handle pool) {
+  AM_STATS_SCOPE(thread);
   return reinterpret_cast<Thread::Pool *>(pool)->HasTasks();
 }
 }
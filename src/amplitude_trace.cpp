@@ -0,0 +1,224 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <amplitude_trace.h>
+
+#include "amplitude_internals.h"
+#include "amplitude_trace.h"
+
+#ifdef AM_C_ENABLE_TRACING
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+static constexpr size_t kEventsPerThread = 1 << 16;
+
+struct TraceEvent {
+  const char *name;
+  std::uint64_t start;
+  std::uint64_t end;
+};
+
+// Written only by its thread, clears included. The count is published after
+// each event, so the exporter can read everything below it without locking.
+struct ThreadTraceBuffer {
+  ThreadTraceBuffer(AmUInt32 id, std::uint64_t generation)
+      : id(id), events(kEventsPerThread), count(0), generation(generation) {}
+
+  AmUInt32 id;
+  std::vector<TraceEvent> events;
+  std::atomic<size_t> count;
+  std::atomic<std::uint64_t> generation; // Of the events in the buffer
+};
+
+std::atomic<bool> TraceScope::s_capturing = false;
+std::atomic<std::uint64_t> TraceScope::s_generation = 0;
+
+static std::atomic<AmUInt64> g_dropped = 0;
+
+// Buffers are never released, threads keep a pointer to theirs
+static std::mutex g_buffers_mutex;
+static std::vector<std::unique_ptr<ThreadTraceBuffer>> g_buffers;
+
+static ThreadTraceBuffer *get_thread_buffer() {
+  thread_local ThreadTraceBuffer *buffer = nullptr;
+
+  if (!buffer) {
+    std::lock_guard lock(g_buffers_mutex);
+    g_buffers.push_back(std::make_unique<ThreadTraceBuffer>(
+        static_cast<AmUInt32>(g_buffers.size() + 1),
+        TraceScope::s_generation.load(std::memory_order_acquire)));
+    buffer = g_buffers.back().get();
+  }
+
+  return buffer;
+}
+
+std::uint64_t TraceScope::Now() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - epoch)
+      .count();
+}
+
+void TraceScope::Record(const char *name, std::uint64_t generation,
+                        std::uint64_t start, std::uint64_t end) {
+  // The span was opened before a clear
+  if (generation != s_generation.load(std::memory_order_acquire))
+    return;
+
+  ThreadTraceBuffer *buffer = get_thread_buffer();
+
+  // Drop the events of older generations. A clear racing with this call makes
+  // the whole buffer stale, so the event is never exported.
+  if (buffer->generation.load(std::memory_order_relaxed) != generation) {
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->generation.store(generation, std::memory_order_release);
+  }
+
+  const size_t index = buffer->count.load(std::memory_order_relaxed);
+  if (index >= kEventsPerThread) {
+    g_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer->events[index] = {name, start, end};
+  buffer->count.store(index + 1, std::memory_order_release);
+}
+
+static bool write_string(File *file, const std::string &str) {
+  return file->Write(reinterpret_cast<AmConstUInt8Buffer>(str.data()),
+                     str.size()) == str.size();
+}
+
+static void append_event(std::string &out, AmUInt32 tid,
+                         const TraceEvent &event) {
+  // Spans are named "<category>.<operation>"
+  const char *dot = std::strchr(event.name, '.');
+  const int category_length =
+      dot ? static_cast<int>(dot - event.name)
+          : static_cast<int>(std::strlen(event.name));
+
+  char line[256];
+  std::snprintf(line, sizeof(line),
+                ",\n{\"name\":\"%s\",\"cat\":\"%.*s\",\"ph\":\"X\",\"pid\":1,"
+                "\"tid\":%" PRIu32 ",\"ts\":%.3f,\"dur\":%.3f}",
+                event.name, category_length, event.name, tid,
+                static_cast<double>(event.start) / 1000.0,
+                static_cast<double>(event.end - event.start) / 1000.0);
+  out += line;
+}
+
+static bool export_trace(File *file) {
+  std::lock_guard lock(g_buffers_mutex);
+
+  const std::uint64_t generation =
+      TraceScope::s_generation.load(std::memory_order_acquire);
+
+  std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                    "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                    "\"args\":{\"name\":\"amplitude\"}}";
+
+  for (const auto &buffer : g_buffers) {
+    char line[128];
+    std::snprintf(line, sizeof(line),
+                  ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                  "\"tid\":%" PRIu32 ",\"args\":{\"name\":\"Thread %" PRIu32
+                  "\"}}",
+                  buffer->id, buffer->id);
+    out += line;
+
+    // Stale buffers are reset by their thread on its next record
+    if (buffer->generation.load(std::memory_order_acquire) != generation)
+      continue;
+
+    const size_t count = buffer->count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+      append_event(out, buffer->id, buffer->events[i]);
+
+      if (out.size() >= 1 << 16) {
+        if (!write_string(file, out))
+          return false;
+        out.clear();
+      }
+    }
+  }
+
+  out += "\n]}\n";
+  return write_string(file, out);
+}
+
+#endif // AM_C_ENABLE_TRACING
+
+extern "C" {
+am_bool am_trace_is_available(void) {
+#ifdef AM_C_ENABLE_TRACING
+  return AM_TRUE;
+#else
+  return AM_FALSE;
+#endif
+}
+
+void am_trace_start(void) {
+#ifdef AM_C_ENABLE_TRACING
+  TraceScope::Now();
+  TraceScope::s_capturing.store(true, std::memory_order_relaxed);
+#endif
+}
+
+void am_trace_stop(void) {
+#ifdef AM_C_ENABLE_TRACING
+  TraceScope::s_capturing.store(false, std::memory_order_relaxed);
+#endif
+}
+
+void am_trace_clear(void) {
+#ifdef AM_C_ENABLE_TRACING
+  if (TraceScope::s_capturing.load(std::memory_order_relaxed))
+    return;
+
+  // Only the owning threads write to their buffers, so they are not reset
+  // here. Bumping the generation hides their events until they do.
+  TraceScope::s_generation.fetch_add(1, std::memory_order_acq_rel);
+  g_dropped.store(0, std::memory_order_relaxed);
+#endif
+}
+
+am_uint64 am_trace_get_dropped_count(void) {
+#ifdef AM_C_ENABLE_TRACING
+  return g_dropped.load(std::memory_order_relaxed);
+#else
+  return 0;
+#endif
+}
+
+am_bool am_trace_export(am_file_handle file) {
+#ifdef AM_C_ENABLE_TRACING
+  if (!file.handle)
+    return AM_FALSE;
+
+  return BOOL_TO_AM_BOOL(export_trace(static_cast<File *>(file.handle)));
+#else
+  (void)file;
+  return AM_FALSE;
+#endif
+}
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_TRACE_H
+#define _AM_IMPLEMENTATION_TRACE_H
+
+#ifdef AM_C_ENABLE_TRACING
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Records a span covering its own lifetime, while a trace is being captured.
+ *
+ * The name must be a string literal, only its address is recorded.
+ */
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name)
+        : _name(s_capturing.load(std::memory_order_relaxed) ? name : nullptr)
+        , _generation(s_generation.load(std::memory_order_relaxed))
+        , _start(_name ? Now() : 0)
+    {}
+
+    ~TraceScope()
+    {
+        if (_name)
+            Record(_name, _generation, _start, Now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /**
+     * @brief Gets the number of nanoseconds elapsed since the first trace call of the process.
+     */
+    static std::uint64_t Now();
+
+    /**
+     * @brief Records a span in the buffer of the calling thread.
+     *
+     * Spans opened before the last clear are dropped.
+     */
+    static void Record(const char* name, std::uint64_t generation, std::uint64_t start, std::uint64_t end);
+
+    static std::atomic<bool> s_capturing;
+
+    /**
+     * @brief Incremented by each clear. Buffers holding events of an older generation are
+     * ignored, and reset by their own thread on its next record.
+     */
+    static std::atomic<std::uint64_t> s_generation;
+
+private:
+    const char* _name;
+    std::uint64_t _generation;
+    std::uint64_t _start;
+};
+
+#define AM_TRACE_CONCAT_IMPL(a, b) a##b
+#define AM_TRACE_CONCAT(a, b) AM_TRACE_CONCAT_IMPL(a, b)
+#define AM_TRACE_SCOPE(name) const TraceScope AM_TRACE_CONCAT(_am_trace_scope_, __LINE__)(name)
+
+#else
+
+#define AM_TRACE_SCOPE(name) ((void)0)
+
+#endif // AM_C_ENABLE_TRACING
+
+#endif // _AM_IMPLEMENTATION_TRACE_H
@@ -0,0 +1,123 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "amplitude_capture.h"
+#include "amplitude_velocity_tracker.h"
+
+am_velocity_tracking_config VelocityTracker::s_config = {0.1f, 100.0f, 0.5f};
+std::mutex VelocityTracker::s_config_mutex;
+
+VelocityTracker &VelocityTracker::Entities() {
+  static VelocityTracker tracker;
+  return tracker;
+}
+
+VelocityTracker &VelocityTracker::Listeners() {
+  static VelocityTracker tracker;
+  return tracker;
+}
+
+void VelocityTracker::SetConfig(const am_velocity_tracking_config &config) {
+  std::lock_guard lock(s_config_mutex);
+  s_config = config;
+}
+
+am_velocity_tracking_config VelocityTracker::GetConfig() {
+  std::lock_guard lock(s_config_mutex);
+  return s_config;
+}
+
+void VelocityTracker::Update(const void *key, const am_vec3 &location,
+                             am_time time) {
+  const am_velocity_tracking_config config = GetConfig();
+
+  std::lock_guard lock(_mutex);
+
+  const auto it = _tracks.find(key);
+  if (it == _tracks.end()) {
+    _tracks.emplace(key, Track{location, {0.0f, 0.0f, 0.0f}, time});
+    return;
+  }
+
+  Track &track = it->second;
+
+  // Out of order or duplicated updates carry no motion information
+  const am_time dt = time - track.time;
+  if (dt <= 0.0)
+    return;
+
+  const am_vec3 delta = {location.x - track.location.x,
+                         location.y - track.location.y,
+                         location.z - track.location.z};
+
+  track.location = location;
+  track.time = time;
+
+  if (config.max_time_step > 0.0f && dt > config.max_time_step) {
+    track.velocity = {0.0f, 0.0f, 0.0f};
+    return;
+  }
+
+  const auto inv_dt = static_cast<am_float32>(1.0 / dt);
+  const am_vec3 raw = {delta.x * inv_dt, delta.y * inv_dt, delta.z * inv_dt};
+
+  // Teleports move the object, but keep the velocity it had before
+  const am_float32 speed_sq = raw.x * raw.x + raw.y * raw.y + raw.z * raw.z;
+  if (config.max_speed > 0.0f && speed_sq > config.max_speed * config.max_speed)
+    return;
+
+  // Frame rate independent exponential smoothing
+  const am_float32 alpha =
+      config.smoothing_time > 0.0f
+          ? static_cast<am_float32>(1.0 - std::exp(-dt / config.smoothing_time))
+          : 1.0f;
+
+  track.velocity.x += (raw.x - track.velocity.x) * alpha;
+  track.velocity.y += (raw.y - track.velocity.y) * alpha;
+  track.velocity.z += (raw.z - track.velocity.z) * alpha;
+}
+
+am_vec3 VelocityTracker::GetVelocity(const void *key) const {
+  std::lock_guard lock(_mutex);
+
+  const auto it = _tracks.find(key);
+  if (it == _tracks.end())
+    return {0.0f, 0.0f, 0.0f};
+
+  return it->second.velocity;
+}
+
+void VelocityTracker::Reset(const void *key) {
+  std::lock_guard lock(_mutex);
+  _tracks.erase(key);
+}
+
+extern "C" {
+void am_velocity_tracking_set_config(
+    const am_velocity_tracking_config *config) {
+  if (!config)
+    return;
+
+  AM_CAPTURE(VelocityTrackingSetConfig, *config);
+  VelocityTracker::SetConfig(*config);
+}
+
+void am_velocity_tracking_get_config(am_velocity_tracking_config *config) {
+  AM_CAPTURE_CALL(VelocityTrackingGetConfig);
+  if (config)
+    *config = VelocityTracker::GetConfig();
+}
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2025-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_VELOCITY_TRACKER_H
+#define _AM_VELOCITY_TRACKER_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include <amplitude_velocity.h>
+
+/**
+ * @brief Derives smoothed velocities from timestamped location updates.
+ *
+ * One tracker exists for entities and one for listeners, keyed by their handles. The engine
+ * computes its own velocity from the location change between two updates, which jitters with the
+ * frame time; this estimate divides by the real elapsed time instead, and filters the result.
+ */
+class VelocityTracker
+{
+public:
+    VelocityTracker(const VelocityTracker&) = delete;
+    VelocityTracker& operator=(const VelocityTracker&) = delete;
+
+    /**
+     * @brief Gets the tracker of the entities.
+     */
+    static VelocityTracker& Entities();
+
+    /**
+     * @brief Gets the tracker of the listeners.
+     */
+    static VelocityTracker& Listeners();
+
+    static void SetConfig(const am_velocity_tracking_config& config);
+
+    static am_velocity_tracking_config GetConfig();
+
+    /**
+     * @brief Records a new location of an object.
+     *
+     * @param[in] key The handle of the object.
+     * @param[in] location The new location.
+     * @param[in] time The time of the location, in seconds. Updates older than the last one are
+     * ignored.
+     */
+    void Update(const void* key, const am_vec3& location, am_time time);
+
+    /**
+     * @brief Gets the velocity of an object, or a zero velocity if it has no tracked locations.
+     */
+    [[nodiscard]] am_vec3 GetVelocity(const void* key) const;
+
+    /**
+     * @brief Forgets the tracked locations of an object.
+     */
+    void Reset(const void* key);
+
+private:
+    struct Track
+    {
+        am_vec3 location;
+        am_vec3 velocity;
+        am_time time;
+    };
+
+    VelocityTracker() = default;
+
+    std::unordered_map<const void*, Track> _tracks;
+    mutable std::mutex _mutex;
+
+    static am_velocity_tracking_config s_config;
+    static std::mutex s_config_mutex;
+};
+
+#endif // _AM_VELOCITY_TRACKER_H
@@ -26,12 +26,69 @@ add_rules("plugin.compile_commands.autoupdate")
 add_requireconfs("*", { debug = is_mode("debug") })
 add_requires("amplitudeaudiosdk fix/release-stabilization")
 
+option("tracing")
+  set_default(false)
+  set_showmenu(true)
+  set_description("Record tracing spans on the hot paths, exportable as Chrome trace JSON")
+  add_defines("AM_C_ENABLE_TRACING")
+option_end()
+
+option("stats")
+  set_default(false)
+  set_showmenu(true)
+  set_description("Count C API calls and record their latency, readable with am_stats_snapshot()")
+  add_defines("AM_C_ENABLE_STATS")
+option_end()
+
 target("amplitude_c")
   set_kind("shared")
   add_files("src/**.cpp")
   add_includedirs("include")
   add_packages("amplitudeaudiosdk")
   add_defines("AM_BUILDSYSTEM_BUILDING_AMPLITUDE")
+  add_options("tracing", "stats")
 
   add_headerfiles("include/**.h")
 target_end()
+
+target("amplitude_c_bench_resampler")
+  set_kind("binary")
+  set_default(false)
+  add_files("bench/bench_resampler.cpp")
+  add_includedirs("include")
+  add_deps("amplitude_c")
+target_end()
+
+target("amplitude_c_bench")
+  set_kind("binary")
+  set_default(false)
+  add_files("bench/bench_api.cpp")
+  add_includedirs("include")
+  add_packages("amplitudeaudiosdk")
+  add_deps("amplitude_c")
+target_end()
+
+target("amplitude_c_bench_codec")
+  set_kind("binary")
+  set_default(false)
+  add_files("bench/bench_codec.cpp")
+  add_includedirs("include")
+  add_packages("amplitudeaudiosdk")
+  add_deps("amplitude_c")
+target_end()
+
+target("amplitude_c_bench_registry")
+  set_kind("binary")
+  set_default(false)
+  add_files("bench/bench_registry.cpp", "src/amplitude_shared_ptr_manager.cpp")
+  add_includedirs("include", "src")
+target_end()
+
+target("amplitude_c_replay")
+  set_kind("binary")
+  set_default(false)
+  add_files("bench/replay.cpp")
+  add_includedirs("include")
+  add_packages("amplitudeaudiosdk")
+  add_deps("amplitude_c")
+target_end()